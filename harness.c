@@ -1,7 +1,9 @@
 /* Test support code */
 
+#include <pthread.h>
 #include <setjmp.h>
 #include <signal.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -28,41 +30,204 @@
 /* Byte to fill newly malloced space with */
 #define FILLCHAR 0x55
 
+/* Small blocks are carved out of slab chunks of this size */
+#define SLAB_CHUNK_SIZE (64 * 1024)
+
+/* Largest block (header, payload and footer) served from a slab chunk */
+#define SLAB_BLOCK_MAX 512
+
+/* Slab chunks hide individual blocks from the sanitizer, so leave every
+ * allocation to the C library when it is enabled.
+ */
+#if defined(__SANITIZE_ADDRESS__)
+#define SLAB_ENABLED 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define SLAB_ENABLED 0
+#endif
+#endif
+#ifndef SLAB_ENABLED
+#define SLAB_ENABLED 1
+#endif
+
+/* Whether blocks bypassing the slab are tracked for cautious mode. Without
+ * slabs every block bypasses it, and tracking them all would add a locked
+ * hash set update to every allocation and free. The sanitizer that disabled
+ * the slabs reports invalid frees instead.
+ */
+#define LARGE_TRACKED SLAB_ENABLED
+
 /* Data structures used by our code */
 
-/* Represent allocated blocks as doubly-linked list, with
- * next and prev pointers at beginning
+/* Chunk of memory that small blocks are carved from, in address order.
+ * A chunk is returned to the C library once every block carved from it has
+ * been freed, so releasing a whole queue releases its chunks wholesale.
+ *
+ * Chunks are aligned to their size, so the chunk of any address is found by
+ * masking it. @live_map has a bit for each 16-byte unit of @data, set where
+ * a live block starts, which lets cautious mode check a block in constant
+ * time.
+ *
+ * Only the thread serving blocks from a chunk moves its cursor, but any
+ * thread may free a block carved from it, so the count and the map are
+ * updated atomically.
  */
+typedef struct __slab_chunk {
+    /* Blocks carved from this chunk and not yet given back. While a thread
+     * serves blocks from the chunk, it is charged CHUNK_CREDIT more up front,
+     * minus @carved, so that carving a block needs no atomic update.
+     */
+    atomic_size_t live;
+    size_t carved; /* Blocks carved since the chunk was last started over */
+    unsigned char *cursor, *end;
+    _Atomic uint64_t live_map[SLAB_CHUNK_SIZE / 16 / 64];
+    unsigned char data[0] __attribute__((aligned(16)));
+} slab_chunk_t;
+
+/* More than the number of blocks that fit in a chunk */
+#define CHUNK_CREDIT (SLAB_CHUNK_SIZE / 16 + 1)
+
+/* Set of pointers, with open addressing and linear probing in a table at
+ * most half full. A removal shifts the entries after it back rather than
+ * leaving a tombstone.
+ */
+typedef struct {
+    void **slots;
+    size_t mask; /* Table size minus one, if there is a table */
+    size_t count;
+} ptr_set_t;
+
+#define PTR_SET_MIN_SIZE 64
+
+/* Header in front of every allocated block */
 typedef struct __block_element {
-    struct __block_element *next, *prev;
     size_t payload_size;
     size_t magic_header; /* Marker to see if block seems legitimate */
-    unsigned char payload[0];
+    slab_chunk_t *chunk; /* Owning slab chunk, NULL if from the C library */
+    union {
+        size_t usable; /* Room for the payload, while the block is live */
+        struct __block_element *next_free; /* Next block cached in its size
+                                            * class, once freed */
+    };
+    unsigned char payload[0] __attribute__((aligned(16)));
     /* Also place magic number at tail of every block */
 } block_element_t;
 
-static block_element_t *allocated = NULL;
-static size_t allocated_count = 0;
+/* Bytes a block takes beside its payload */
+#define BLOCK_OVERHEAD (sizeof(block_element_t) + sizeof(size_t))
+
+/* Live slab chunks, and live blocks that are not carved from a chunk, spread
+ * over shards by address so that threads seldom wait on the same lock. The
+ * sets of a shard are usually small enough to stay in cache: a chunk holds
+ * hundreds of blocks, and only large blocks bypass the slab unless it is
+ * disabled.
+ */
+#define REGISTRY_SHARDS 16
+
+static struct {
+    pthread_mutex_t lock;
+    ptr_set_t chunks;
+    ptr_set_t large;
+} registry[REGISTRY_SHARDS] = {
+    [0 ... REGISTRY_SHARDS - 1] = {.lock = PTHREAD_MUTEX_INITIALIZER},
+};
+
+/* Counts chunks returned to the C library, and the chunk the calling thread
+ * last found registered, as of that count
+ */
+static atomic_ulong chunk_generation = 0;
+static _Thread_local const slab_chunk_t *known_chunk = NULL;
+static _Thread_local unsigned long known_generation = 0;
+
+/* Freed slab blocks wait in quarantine for this many further frees before
+ * they may be handed out again, so that a write through a dangling pointer
+ * still shows in the fill pattern and gets reported.
+ */
+#define QUARANTINE_SIZE 256
+
+/* Most freed blocks kept for reuse in each size class. Each one keeps its
+ * chunk from being returned to the C library, so the cache stays small.
+ */
+#define SIZE_CLASS_CACHE_MAX 512
+
+/* Slab blocks come in multiples of 16 bytes up to SLAB_BLOCK_MAX */
+#define N_SIZE_CLASSES (SLAB_BLOCK_MAX / 16)
+
+/* Allocator state of a thread. Blocks freed by a thread go through its own
+ * quarantine and cache, whichever thread allocated them, so allocating and
+ * freeing take no lock unless a chunk is started or returned.
+ */
+typedef struct __thread_cache {
+    /* Chunk currently used to serve small blocks */
+    slab_chunk_t *current;
+
+    /* Ring of quarantined blocks, oldest at quarantine[quarantine_next]
+     * once the ring is full
+     */
+    block_element_t *quarantine[QUARANTINE_SIZE];
+    size_t quarantine_next, quarantine_count;
+
+    /* Freed blocks ready for reuse, a stack for each size class */
+    struct {
+        block_element_t *top;
+        size_t count;
+    } size_classes[N_SIZE_CLASSES];
+
+    /* Slab-sized allocations served from the cache, and the others */
+    size_t hits, misses;
+
+    /* Blocks allocated minus blocks freed by this thread. Only the thread
+     * writes it, so no update needs an atomic read-modify-write.
+     */
+    atomic_long allocated;
+
+    struct __thread_cache *next; /* In the list of all thread caches */
+} thread_cache_t;
+
+static _Thread_local thread_cache_t *tcache = NULL;
+
+/* Set by set_fresh_mode(): allocations skip the cache of freed blocks */
+static _Thread_local bool alloc_fresh = false;
+
+/* Thread caches in use, and the block count left by threads that exited */
+static pthread_mutex_t tcaches_lock = PTHREAD_MUTEX_INITIALIZER;
+static thread_cache_t *tcaches = NULL;
+static atomic_long retired_allocated = 0;
+
+/* Flushes the cache of a thread when it exits */
+static pthread_key_t tcache_key;
+static pthread_once_t tcache_key_once = PTHREAD_ONCE_INIT;
 
 /* Percent probability of malloc failure */
 int fail_probability = 0;
 
 static bool cautious_mode = true;
 static bool noallocate_mode = false;
-static bool error_occurred = false;
-static char *error_message = "";
 
-static int time_limit = 1;
+/* Set by set_threaded_mode(): until then there is one thread and no locks */
+static atomic_bool threaded_mode = false;
+static atomic_bool error_occurred = false;
+
+/* Time limit in seconds for each risky operation, 0 for none */
+int time_limit = 1;
+
+/* Data for managing exceptions, one context for each thread */
+static _Thread_local char *error_message = "";
+static _Thread_local sigjmp_buf env;
+static _Thread_local volatile sig_atomic_t jmp_ready = false;
+static _Thread_local bool time_limited = false;
 
-/* Data for managing exceptions */
-static jmp_buf env;
-static volatile sig_atomic_t jmp_ready = false;
-static bool time_limited = false;
+/* Depth of critical sections the thread is in, and whether an exception
+ * was raised meanwhile
+ */
+static _Thread_local volatile sig_atomic_t critical_depth = 0;
+static _Thread_local volatile sig_atomic_t exception_pending = false;
 
 /* For test_malloc and test_calloc */
 typedef enum {
     TEST_MALLOC,
     TEST_CALLOC,
+    TEST_REALLOC,
 } alloc_t;
 
 /* Internal functions */
@@ -74,6 +239,218 @@ static bool fail_allocation()
     return (weight < 0.01 * fail_probability);
 }
 
+/* Home slot of @p in @set */
+static inline size_t ptr_set_slot(const ptr_set_t *set, const void *p)
+{
+    /* Fibonacci hashing: the high bits of the product mix all address bits */
+    uint64_t h = (uint64_t) (uintptr_t) p * 0x9e3779b97f4a7c15ULL;
+    return (size_t) (h >> 32) & set->mask;
+}
+
+/* Slot holding @p, or the empty slot ending its probe sequence */
+static size_t ptr_set_probe(const ptr_set_t *set, const void *p)
+{
+    size_t i = ptr_set_slot(set, p);
+    while (set->slots[i] && set->slots[i] != p)
+        i = (i + 1) & set->mask;
+    return i;
+}
+
+static bool ptr_set_contains(const ptr_set_t *set, const void *p)
+{
+    return set->slots && set->slots[ptr_set_probe(set, p)] == p;
+}
+
+/* Add @p to @set. Return false if the table cannot grow to make room. */
+static bool ptr_set_add(ptr_set_t *set, void *p)
+{
+    size_t size = set->slots ? set->mask + 1 : 0;
+    if ((set->count + 1) * 2 > size) {
+        size_t new_size = size ? size * 2 : PTR_SET_MIN_SIZE;
+        void **old = set->slots;
+
+        set->slots = calloc(new_size, sizeof(*set->slots));
+        if (!set->slots) {
+            set->slots = old;
+            return false;
+        }
+        set->mask = new_size - 1;
+        for (size_t i = 0; i < size; i++) {
+            if (old[i])
+                set->slots[ptr_set_probe(set, old[i])] = old[i];
+        }
+        free(old);
+    }
+    set->slots[ptr_set_probe(set, p)] = p;
+    set->count++;
+    return true;
+}
+
+/* Remove @p from @set, if it is there */
+static void ptr_set_remove(ptr_set_t *set, const void *p)
+{
+    if (!set->slots)
+        return;
+
+    size_t i = ptr_set_probe(set, p);
+    if (!set->slots[i])
+        return;
+
+    /* Move back every following entry of the run that may not be left
+     * behind the hole: one whose home slot is not between the hole and it.
+     */
+    set->slots[i] = NULL;
+    for (size_t j = (i + 1) & set->mask; set->slots[j];
+         j = (j + 1) & set->mask) {
+        size_t home = ptr_set_slot(set, set->slots[j]);
+        if (((j - home) & set->mask) >= ((j - i) & set->mask)) {
+            set->slots[i] = set->slots[j];
+            set->slots[j] = NULL;
+            i = j;
+        }
+    }
+    set->count--;
+}
+
+/* A signal handler raising an exception, such as the time limit, must not
+ * jump out while the allocator state is being updated or a lock is held.
+ * Within a critical section the exception is raised once the section ends
+ * instead. Nothing in a critical section may touch memory passed in by the
+ * caller, whose faults must still raise an exception on the spot.
+ */
+static inline void critical_enter()
+{
+    critical_depth++;
+}
+
+static inline void critical_leave()
+{
+    if (--critical_depth == 0 && exception_pending) {
+        exception_pending = false;
+        trigger_exception(error_message);
+    }
+}
+
+/* The lock is only taken in threaded mode. The mode is set before the
+ * threads sharing the allocator start, so the test is stable while any of
+ * them holds a lock.
+ */
+static void harness_lock(pthread_mutex_t *lock)
+{
+    critical_enter();
+    if (atomic_load_explicit(&threaded_mode, memory_order_relaxed))
+        pthread_mutex_lock(lock);
+}
+
+static void harness_unlock(pthread_mutex_t *lock)
+{
+    if (atomic_load_explicit(&threaded_mode, memory_order_relaxed))
+        pthread_mutex_unlock(lock);
+    critical_leave();
+}
+
+/* Registry shard of address @p */
+static inline size_t registry_shard(const void *p)
+{
+    uint64_t h = (uint64_t) (uintptr_t) p * 0x9e3779b97f4a7c15ULL;
+    return (size_t) (h >> 60) % REGISTRY_SHARDS;
+}
+
+/* Add @p to the registry, as a chunk or as a large block.
+ * Return false if there was no memory to do so.
+ */
+static bool registry_add(void *p, bool chunk)
+{
+    size_t i = registry_shard(p);
+    harness_lock(&registry[i].lock);
+    bool ok = ptr_set_add(chunk ? &registry[i].chunks : &registry[i].large, p);
+    harness_unlock(&registry[i].lock);
+    return ok;
+}
+
+static void registry_remove(const void *p, bool chunk)
+{
+    size_t i = registry_shard(p);
+    harness_lock(&registry[i].lock);
+    ptr_set_remove(chunk ? &registry[i].chunks : &registry[i].large, p);
+    harness_unlock(&registry[i].lock);
+}
+
+/* Bit of block @b in the live map of chunk @c */
+static inline size_t live_bit(const slab_chunk_t *c, const block_element_t *b)
+{
+    return ((uintptr_t) b - (uintptr_t) c->data) >> 4;
+}
+
+/* Mark block @b of chunk @c live or not.
+ * Return whether it was live before.
+ */
+static inline bool live_mark(slab_chunk_t *c, block_element_t *b, bool live)
+{
+    size_t bit = live_bit(c, b);
+    uint64_t mask = (uint64_t) 1 << (bit % 64);
+    _Atomic uint64_t *word = &c->live_map[bit / 64];
+    uint64_t old;
+    if (live)
+        old = atomic_fetch_or_explicit(word, mask, memory_order_relaxed);
+    else
+        old = atomic_fetch_and_explicit(word, ~mask, memory_order_relaxed);
+    return old & mask;
+}
+
+/* Whether @b is the header of a live block */
+static bool block_is_live(const block_element_t *b)
+{
+    /* Without slabs there are no chunks and no block is tracked */
+    if (!SLAB_ENABLED)
+        return true;
+
+    slab_chunk_t *c =
+        (slab_chunk_t *) ((uintptr_t) b & ~(uintptr_t) (SLAB_CHUNK_SIZE - 1));
+    bool live = false;
+
+    /* Frees tend to come in runs within a chunk, so the last chunk found is
+     * remembered until any chunk is returned. A chunk holding a live block is
+     * not returned; only a bogus pointer may see one go while it is read.
+     */
+    if (c == known_chunk &&
+        atomic_load_explicit(&chunk_generation, memory_order_acquire) ==
+            known_generation) {
+        if ((unsigned char *) b >= c->data) {
+            size_t bit = live_bit(c, b);
+            uint64_t word = atomic_load_explicit(&c->live_map[bit / 64],
+                                                 memory_order_relaxed);
+            live = word >> (bit % 64) & 1;
+        }
+        return live;
+    }
+
+    /* The chunk is not returned while its shard is locked */
+    size_t i = registry_shard(c);
+    harness_lock(&registry[i].lock);
+    unsigned long generation =
+        atomic_load_explicit(&chunk_generation, memory_order_acquire);
+    bool in_chunk = ptr_set_contains(&registry[i].chunks, c);
+    if (in_chunk && (unsigned char *) b >= c->data) {
+        size_t bit = live_bit(c, b);
+        uint64_t word = atomic_load_explicit(&c->live_map[bit / 64],
+                                             memory_order_relaxed);
+        live = word >> (bit % 64) & 1;
+    }
+    harness_unlock(&registry[i].lock);
+    if (in_chunk) {
+        known_chunk = c;
+        known_generation = generation;
+        return live;
+    }
+
+    i = registry_shard(b);
+    harness_lock(&registry[i].lock);
+    live = ptr_set_contains(&registry[i].large, b);
+    harness_unlock(&registry[i].lock);
+    return live;
+}
+
 /* Find header of block, given its payload.
  * Signal error if doesn't seem like legitimate block
  */
@@ -88,13 +465,7 @@ static block_element_t *find_header(void *p)
         (block_element_t *) ((size_t) p - sizeof(block_element_t));
     if (cautious_mode) {
         /* Make sure this is really an allocated block */
-        block_element_t *ab = allocated;
-        bool found = false;
-        while (ab && !found) {
-            found = ab == b;
-            ab = ab->next;
-        }
-        if (!found) {
+        if (!block_is_live(b)) {
             report_event(MSG_ERROR,
                          "Attempted to free unallocated block.  Address = %p",
                          p);
@@ -113,6 +484,90 @@ static block_element_t *find_header(void *p)
     return b;
 }
 
+/* Drop @n from the count of chunk @c, returning the chunk to the C library
+ * if nothing is left
+ */
+static void chunk_put(slab_chunk_t *c, size_t n)
+{
+    if (atomic_fetch_sub_explicit(&c->live, n, memory_order_acq_rel) == n) {
+        registry_remove(c, true);
+        atomic_fetch_add_explicit(&chunk_generation, 1, memory_order_release);
+        free(c);
+    }
+}
+
+/* Carve a block of @size bytes out of the current slab chunk of @tc,
+ * starting a new chunk when it runs out of room. Return NULL if the block is
+ * too large to be served from a slab.
+ */
+static block_element_t *slab_alloc(thread_cache_t *tc, size_t size)
+{
+    size = (size + 15) & ~(size_t) 15;
+    if (!SLAB_ENABLED || size > SLAB_BLOCK_MAX)
+        return NULL;
+
+    slab_chunk_t *c = tc->current;
+    if (!c || (size_t) (c->end - c->cursor) < size) {
+        if (c && atomic_load_explicit(&c->live, memory_order_acquire) ==
+                     CHUNK_CREDIT - c->carved) {
+            /* Nothing carved from the chunk is alive; start over */
+            c->cursor = c->data;
+            c->carved = 0;
+        } else {
+            void *mem;
+            if (posix_memalign(&mem, SLAB_CHUNK_SIZE, SLAB_CHUNK_SIZE))
+                return NULL;
+            if (!registry_add(mem, true)) {
+                free(mem);
+                return NULL;
+            }
+            if (c)
+                chunk_put(c, CHUNK_CREDIT - c->carved);
+            c = mem;
+            atomic_init(&c->live, CHUNK_CREDIT);
+            c->carved = 0;
+            for (size_t i = 0; i < SLAB_CHUNK_SIZE / 16 / 64; i++)
+                atomic_init(&c->live_map[i], 0);
+            c->cursor = c->data;
+            c->end = (unsigned char *) c + SLAB_CHUNK_SIZE;
+            tc->current = c;
+        }
+    }
+
+    block_element_t *b = (block_element_t *) c->cursor;
+    c->cursor += size;
+    c->carved++;
+    live_mark(c, b, true);
+    b->chunk = c;
+    b->usable = size - BLOCK_OVERHEAD;
+    return b;
+}
+
+/* Grow slab block @b to hold @size bytes of payload without moving it.
+ * This works when it is the last block carved from the current chunk of @tc
+ * and the chunk has room left. Return whether it was grown.
+ */
+static bool slab_grow(thread_cache_t *tc, block_element_t *b, size_t size)
+{
+    slab_chunk_t *c = b->chunk;
+    size_t old_size = b->usable + BLOCK_OVERHEAD;
+    size_t new_size = (size + BLOCK_OVERHEAD + 15) & ~(size_t) 15;
+    if (!c || c != tc->current || new_size > SLAB_BLOCK_MAX ||
+        (unsigned char *) b + old_size != c->cursor ||
+        (size_t) (c->end - (unsigned char *) b) < new_size)
+        return false;
+
+    c->cursor = (unsigned char *) b + new_size;
+    b->usable = new_size - BLOCK_OVERHEAD;
+    return true;
+}
+
+/* Give a block back to its slab chunk, once it has left the cache */
+static void slab_free(block_element_t *b)
+{
+    chunk_put(b->chunk, 1);
+}
+
 /* Given pointer to block, find its footer */
 static size_t *find_footer(block_element_t *b)
 {
@@ -122,31 +577,425 @@ static size_t *find_footer(block_element_t *b)
     return p;
 }
 
-static void *alloc(alloc_t alloc_type, size_t size)
+/* Size class of slab blocks of @size bytes, or -1 if they bypass the slab */
+static int size_class(size_t size)
+{
+    size = (size + 15) & ~(size_t) 15;
+    if (!SLAB_ENABLED || size > SLAB_BLOCK_MAX)
+        return -1;
+    return (int) (size / 16) - 1;
+}
+
+/* Check that freed block @b still holds what test_free() left in it.
+ * Return false, after reporting the error, if it was written to.
+ */
+static bool check_freed(block_element_t *b)
+{
+    bool intact = b->magic_header == MAGICFREE &&
+                  b->payload_size <= SLAB_BLOCK_MAX - BLOCK_OVERHEAD &&
+                  *find_footer(b) == MAGICFREE;
+    /* The payload is 16-byte aligned; compare it a word at a time */
+    const uint64_t fill = 0x0101010101010101ULL * FILLCHAR;
+    const uint64_t *w = (const uint64_t *) b->payload;
+    size_t n = intact ? b->payload_size : 0;
+    for (; n >= sizeof(*w); n -= sizeof(*w))
+        intact &= *w++ == fill;
+    for (const unsigned char *c = (const unsigned char *) w; n; n--)
+        intact &= *c++ == FILLCHAR;
+    if (!intact) {
+        report_event(MSG_ERROR,
+                     "Block with address %p was written to after being freed",
+                     (void *) &b->payload);
+        error_occurred = true;
+    }
+    return intact;
+}
+
+/* Move freed block @b out of the quarantine of @tc, into the cache of its
+ * size class if there is room. It is checked for writes once it leaves the
+ * cache, either handed out again or given back to its chunk.
+ */
+static void cache_put(thread_cache_t *tc, block_element_t *b)
+{
+    int k = size_class(b->usable + BLOCK_OVERHEAD);
+    if (!tc || k < 0 || tc->size_classes[k].count == SIZE_CLASS_CACHE_MAX) {
+        /* A block that was written to is never used again */
+        if (check_freed(b))
+            slab_free(b);
+        return;
+    }
+    b->next_free = tc->size_classes[k].top;
+    tc->size_classes[k].top = b;
+    tc->size_classes[k].count++;
+}
+
+/* Put freed slab block @b in the quarantine of @tc, moving out the oldest one
+ * if full
+ */
+static void quarantine_push(thread_cache_t *tc, block_element_t *b)
+{
+    if (!tc) {
+        cache_put(tc, b);
+        return;
+    }
+    if (tc->quarantine_count < QUARANTINE_SIZE) {
+        tc->quarantine[tc->quarantine_count++] = b;
+        return;
+    }
+    block_element_t *oldest = tc->quarantine[tc->quarantine_next];
+    tc->quarantine[tc->quarantine_next] = b;
+    tc->quarantine_next = (tc->quarantine_next + 1) % QUARANTINE_SIZE;
+    cache_put(tc, oldest);
+}
+
+/* Take a block for @size bytes from the cache of @tc, marking it live.
+ * Return NULL if the size class has none, or the block is too large to be
+ * served from a slab.
+ */
+static block_element_t *cache_take(thread_cache_t *tc, size_t size)
+{
+    int k = size_class(size);
+    if (k < 0)
+        return NULL;
+
+    while (tc->size_classes[k].top) {
+        block_element_t *b = tc->size_classes[k].top;
+        tc->size_classes[k].top = b->next_free;
+        tc->size_classes[k].count--;
+        if (!check_freed(b))
+            continue;
+
+        live_mark(b->chunk, b, true);
+        b->usable = (size_t) (k + 1) * 16 - BLOCK_OVERHEAD;
+        tc->hits++;
+        return b;
+    }
+    tc->misses++;
+    return NULL;
+}
+
+/* Give back every block held by thread cache @tc and unregister it */
+static void tcache_release(void *arg)
+{
+    thread_cache_t *tc = arg;
+
+    for (size_t i = 0; i < tc->quarantine_count; i++)
+        cache_put(NULL, tc->quarantine[i]);
+    for (int k = 0; k < N_SIZE_CLASSES; k++) {
+        for (block_element_t *b = tc->size_classes[k].top, *next; b;
+             b = next) {
+            next = b->next_free;
+            cache_put(NULL, b);
+        }
+    }
+    if (tc->current)
+        chunk_put(tc->current, CHUNK_CREDIT - tc->current->carved);
+
+    harness_lock(&tcaches_lock);
+    thread_cache_t **pp = &tcaches;
+    while (*pp != tc)
+        pp = &(*pp)->next;
+    *pp = tc->next;
+    atomic_fetch_add(&retired_allocated, atomic_load(&tc->allocated));
+    harness_unlock(&tcaches_lock);
+
+    free(tc);
+    tcache = NULL;
+}
+
+static void tcache_make_key()
+{
+    pthread_key_create(&tcache_key, tcache_release);
+}
+
+/* Cache of the calling thread, set up on first use.
+ * Return NULL if there is no memory for it.
+ */
+static thread_cache_t *thread_cache()
+{
+    if (tcache)
+        return tcache;
+
+    thread_cache_t *tc = calloc(1, sizeof(*tc));
+    if (!tc)
+        return NULL;
+    pthread_once(&tcache_key_once, tcache_make_key);
+    pthread_setspecific(tcache_key, tc);
+
+    /* Turning threaded mode on here could race with a thread in between
+     * taking and releasing a lock, so only report it is missing
+     */
+    if (tcaches && !atomic_load(&threaded_mode)) {
+        report_event(MSG_ERROR,
+                     "Allocation by a second thread without threaded mode");
+        error_occurred = true;
+    }
+
+    harness_lock(&tcaches_lock);
+    tc->next = tcaches;
+    tcaches = tc;
+    harness_unlock(&tcaches_lock);
+    return tcache = tc;
+}
+
+/* Add @delta to the count of allocated blocks, on behalf of @tc if any */
+static void count_allocated(thread_cache_t *tc, long delta)
+{
+    if (!tc) {
+        atomic_fetch_add(&retired_allocated, delta);
+        return;
+    }
+    long n = atomic_load_explicit(&tc->allocated, memory_order_relaxed);
+    atomic_store_explicit(&tc->allocated, n + delta, memory_order_relaxed);
+}
+
+/* Allocation profiling */
+
+/* Most call sites told apart. The last profile gathers the sites past it. */
+#define PROF_MAX_SITES 256
+
+/* Call site of an allocation */
+typedef struct {
+    const char *file;
+    int line;
+} call_site_t;
+
+/* Call site passed by test_site() for the next allocation of the thread */
+static _Thread_local call_site_t pending_site = {NULL, 0};
+
+static atomic_bool profiling = false;
+static pthread_mutex_t prof_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Profiles by call site, in order of first allocation, and a hash index
+ * into them holding an index plus one, 0 for none
+ */
+static alloc_site_t prof_sites[PROF_MAX_SITES];
+static size_t prof_nsites = 0;
+static uint16_t prof_index[PROF_MAX_SITES * 2];
+
+/* Allocations profiled so far: the clock lifetimes are measured with */
+static uint64_t prof_clock = 0;
+
+/* Most bytes live at once in profiled blocks, and those live now */
+static size_t prof_peak_bytes = 0, prof_live_bytes = 0;
+
+/* Live profiled block, with the profile of its call site and the clock at
+ * its allocation
+ */
+typedef struct {
+    const block_element_t *block;
+    uint32_t site;
+    uint64_t birth;
+} prof_block_t;
+
+/* Table of live profiled blocks, with open addressing and linear probing as
+ * in ptr_set_t
+ */
+static prof_block_t *prof_blocks = NULL;
+static size_t prof_blocks_mask = 0, prof_blocks_count = 0;
+
+static inline size_t prof_block_home(const block_element_t *b)
+{
+    uint64_t h = (uint64_t) (uintptr_t) b * 0x9e3779b97f4a7c15ULL;
+    return (size_t) (h >> 32) & prof_blocks_mask;
+}
+
+/* Slot holding @b, or the empty slot ending its probe sequence */
+static size_t prof_block_probe(const block_element_t *b)
+{
+    size_t i = prof_block_home(b);
+    while (prof_blocks[i].block && prof_blocks[i].block != b)
+        i = (i + 1) & prof_blocks_mask;
+    return i;
+}
+
+/* Add @e to the table. Return false if it cannot grow to make room. */
+static bool prof_block_add(prof_block_t e)
+{
+    size_t size = prof_blocks ? prof_blocks_mask + 1 : 0;
+    if ((prof_blocks_count + 1) * 2 > size) {
+        size_t new_size = size ? size * 2 : PTR_SET_MIN_SIZE;
+        prof_block_t *old = prof_blocks;
+
+        prof_blocks = calloc(new_size, sizeof(*prof_blocks));
+        if (!prof_blocks) {
+            prof_blocks = old;
+            return false;
+        }
+        prof_blocks_mask = new_size - 1;
+        for (size_t i = 0; i < size; i++) {
+            if (old[i].block)
+                prof_blocks[prof_block_probe(old[i].block)] = old[i];
+        }
+        free(old);
+    }
+    prof_blocks[prof_block_probe(e.block)] = e;
+    prof_blocks_count++;
+    return true;
+}
+
+/* Remove the entry of @b from the table into @e.
+ * Return false if @b is not there.
+ */
+static bool prof_block_remove(const block_element_t *b, prof_block_t *e)
+{
+    if (!prof_blocks)
+        return false;
+
+    size_t i = prof_block_probe(b);
+    if (!prof_blocks[i].block)
+        return false;
+
+    *e = prof_blocks[i];
+    prof_blocks[i].block = NULL;
+    for (size_t j = (i + 1) & prof_blocks_mask; prof_blocks[j].block;
+         j = (j + 1) & prof_blocks_mask) {
+        size_t home = prof_block_home(prof_blocks[j].block);
+        if (((j - home) & prof_blocks_mask) >=
+            ((j - i) & prof_blocks_mask)) {
+            prof_blocks[i] = prof_blocks[j];
+            prof_blocks[j].block = NULL;
+            i = j;
+        }
+    }
+    prof_blocks_count--;
+    return true;
+}
+
+/* Profile of call site @site, created on first use */
+static uint32_t prof_site(call_site_t site)
+{
+    uint64_t h = ((uint64_t) (uintptr_t) site.file ^ (uint64_t) site.line) *
+                 0x9e3779b97f4a7c15ULL;
+    size_t mask = PROF_MAX_SITES * 2 - 1;
+    size_t i = (size_t) (h >> 32) & mask;
+    for (; prof_index[i]; i = (i + 1) & mask) {
+        const alloc_site_t *s = &prof_sites[prof_index[i] - 1];
+        if (s->file == site.file && s->line == site.line)
+            return prof_index[i] - 1;
+    }
+
+    if (prof_nsites == PROF_MAX_SITES - 1)
+        prof_sites[prof_nsites++] = (alloc_site_t){.file = NULL, .line = -1};
+    if (prof_nsites == PROF_MAX_SITES)
+        return PROF_MAX_SITES - 1;
+    prof_sites[prof_nsites] =
+        (alloc_site_t){.file = site.file, .line = site.line};
+    prof_index[i] = ++prof_nsites;
+    return prof_nsites - 1;
+}
+
+/* Record the allocation of block @b with @size bytes at @site */
+static void prof_alloc(const block_element_t *b, size_t size, call_site_t site)
+{
+    harness_lock(&prof_lock);
+    uint32_t k = prof_site(site);
+    alloc_site_t *s = &prof_sites[k];
+    s->allocs++;
+    s->bytes += size;
+    s->live_bytes += size;
+    if (s->live_bytes > s->peak_bytes)
+        s->peak_bytes = s->live_bytes;
+    prof_live_bytes += size;
+    if (prof_live_bytes > prof_peak_bytes)
+        prof_peak_bytes = prof_live_bytes;
+    /* Without room to track it, the block is left out of lifetimes */
+    if (!prof_block_add((prof_block_t){b, k, ++prof_clock})) {
+        s->live_bytes -= size;
+        prof_live_bytes -= size;
+    }
+    harness_unlock(&prof_lock);
+}
+
+/* Record the release of block @b with @size bytes, if it was profiled */
+static void prof_free(const block_element_t *b, size_t size)
+{
+    harness_lock(&prof_lock);
+    prof_block_t e;
+    if (prof_block_remove(b, &e)) {
+        alloc_site_t *s = &prof_sites[e.site];
+        uint64_t age = prof_clock - e.birth;
+        int bucket = age ? 64 - __builtin_clzll(age) : 0;
+        if (bucket >= ALLOC_LIFETIME_BUCKETS)
+            bucket = ALLOC_LIFETIME_BUCKETS - 1;
+        s->frees++;
+        s->lifetime[bucket]++;
+        s->live_bytes -= size;
+        prof_live_bytes -= size;
+    }
+    harness_unlock(&prof_lock);
+}
+
+/* Call site of the allocation under way, which it is the last to use */
+static inline call_site_t site_take()
+{
+    call_site_t site = pending_site;
+    pending_site = (call_site_t){NULL, 0};
+    return site;
+}
+
+static inline bool profiling_on()
+{
+    return atomic_load_explicit(&profiling, memory_order_relaxed);
+}
+
+/* Whether an allocation of @alloc_type may go ahead, reporting it if not */
+static bool alloc_allowed(alloc_t alloc_type)
 {
     if (noallocate_mode) {
         char *msg_alloc_forbidden[] = {
             "Calls to malloc are disallowed",
             "Calls to calloc are disallowed",
+            "Calls to realloc are disallowed",
         };
         report_event(MSG_FATAL, "%s", msg_alloc_forbidden[alloc_type]);
-        return NULL;
+        return false;
     }
 
     if (fail_allocation()) {
         char *msg_alloc_failure[] = {
             "Malloc returning NULL",
             "Calloc returning NULL",
+            "Realloc returning NULL",
         };
         report_event(MSG_WARN, "%s", msg_alloc_failure[alloc_type]);
+        return false;
+    }
+    return true;
+}
+
+/* Allocate a block of @size bytes at @site, zeroed for calloc and filled
+ * otherwise
+ */
+static void *alloc_block(alloc_t alloc_type, size_t size, call_site_t site)
+{
+    critical_enter();
+    thread_cache_t *tc = thread_cache();
+    if (!tc) {
+        report_event(MSG_FATAL, "Couldn't allocate any more memory");
+        error_occurred = true;
+        critical_leave();
         return NULL;
     }
 
+    size_t block_size = size + BLOCK_OVERHEAD;
     block_element_t *new_block =
-        malloc(size + sizeof(block_element_t) + sizeof(size_t));
+        alloc_fresh ? NULL : cache_take(tc, block_size);
+    if (!new_block)
+        new_block = slab_alloc(tc, block_size);
     if (!new_block) {
-        report_event(MSG_FATAL, "Couldn't allocate any more memory");
-        error_occurred = true;
+        new_block = malloc(block_size);
+        if (!new_block) {
+            report_event(MSG_FATAL, "Couldn't allocate any more memory");
+            error_occurred = true;
+        }
+        // cppcheck-suppress nullPointerRedundantCheck
+        new_block->chunk = NULL;
+        new_block->usable = size;
+        if (LARGE_TRACKED && !registry_add(new_block, false)) {
+            report_event(MSG_FATAL, "Couldn't allocate any more memory");
+            error_occurred = true;
+        }
     }
 
     // cppcheck-suppress nullPointerRedundantCheck
@@ -155,25 +1004,46 @@ static void *alloc(alloc_t alloc_type, size_t size)
     new_block->payload_size = size;
     *find_footer(new_block) = MAGICFOOTER;
     void *p = (void *) &new_block->payload;
-    memset(p, !alloc_type * FILLCHAR, size);
-    // cppcheck-suppress nullPointerRedundantCheck
-    new_block->next = allocated;
-    // cppcheck-suppress nullPointerRedundantCheck
-    new_block->prev = NULL;
-
-    if (allocated)
-        allocated->prev = new_block;
-    allocated = new_block;
-    allocated_count++;
+    memset(p, alloc_type == TEST_CALLOC ? 0 : FILLCHAR, size);
+    count_allocated(tc, 1);
+    if (profiling_on())
+        prof_alloc(new_block, size, site);
+    critical_leave();
 
     return p;
 }
 
+static void *alloc(alloc_t alloc_type, size_t size, call_site_t site)
+{
+    if (!alloc_allowed(alloc_type))
+        return NULL;
+    return alloc_block(alloc_type, size, site);
+}
+
+/* Resize block @b, which is not from a slab chunk, with the C library.
+ * Return its new header, or NULL if it could not be resized.
+ */
+static block_element_t *large_resize(block_element_t *b, size_t size)
+{
+    critical_enter();
+    if (LARGE_TRACKED)
+        registry_remove(b, false);
+    block_element_t *new_block = realloc(b, size + BLOCK_OVERHEAD);
+    if (LARGE_TRACKED && !registry_add(new_block ? new_block : b, false)) {
+        report_event(MSG_FATAL, "Couldn't allocate any more memory");
+        error_occurred = true;
+    }
+    if (new_block)
+        new_block->usable = size;
+    critical_leave();
+    return new_block;
+}
+
 /* Implementation of application functions */
 
 void *test_malloc(size_t size)
 {
-    return alloc(TEST_MALLOC, size);
+    return alloc(TEST_MALLOC, size, site_take());
 }
 
 // cppcheck-suppress unusedFunction
@@ -182,9 +1052,10 @@ void *test_calloc(size_t nelem, size_t elsize)
     /* Reference: Malloc tutorial
      * https://danluu.com/malloc-tutorial/
      */
+    call_site_t site = site_take();
     if (!nelem || !elsize || nelem > SIZE_MAX / elsize)
         return NULL;
-    return alloc(TEST_CALLOC, nelem * elsize);
+    return alloc(TEST_CALLOC, nelem * elsize, site);
 }
 
 void test_free(void *p)
@@ -198,6 +1069,24 @@ void test_free(void *p)
         return;
 
     block_element_t *b = find_header(p);
+    /* Releasing it again would corrupt the slab; find_header() reported it */
+    if (b->magic_header == MAGICFREE)
+        return;
+
+    /* Of two threads freeing the same slab block at once, only one clears
+     * its live bit. From then on the block is known to be valid.
+     */
+    critical_enter();
+    if (b->chunk && !live_mark(b->chunk, b, false)) {
+        report_event(MSG_ERROR,
+                     "Attempted to free unallocated block.  Address = %p", p);
+        error_occurred = true;
+        critical_leave();
+        return;
+    }
+    if (profiling_on())
+        prof_free(b, b->payload_size);
+
     size_t footer = *find_footer(b);
     if (footer != MAGICFOOTER) {
         report_event(MSG_ERROR,
@@ -210,18 +1099,94 @@ void test_free(void *p)
     *find_footer(b) = MAGICFREE;
     memset(p, FILLCHAR, b->payload_size);
 
-    /* Unlink from list */
-    block_element_t *bn = b->next;
-    block_element_t *bp = b->prev;
-    if (bp)
-        bp->next = bn;
-    else
-        allocated = bn;
-    if (bn)
-        bn->prev = bp;
+    thread_cache_t *tc = thread_cache();
+    if (b->chunk) {
+        quarantine_push(tc, b);
+    } else {
+        if (LARGE_TRACKED)
+            registry_remove(b, false);
+        free(b);
+    }
+    count_allocated(tc, -1);
+    critical_leave();
+}
+
+/* Blocks keep their place whenever they can: shrinking never moves a block,
+ * and growing does not either while the payload fits in the room the block
+ * was given, or when the block is the last one carved from the current slab
+ * chunk. Other blocks are resized by the C library. Only a slab block that
+ * has to move is copied here.
+ */
+void *test_realloc(void *p, size_t size)
+{
+    call_site_t site = site_take();
+    if (!p)
+        return alloc(TEST_REALLOC, size, site);
+
+    if (!size) {
+        test_free(p);
+        return NULL;
+    }
+
+    if (!alloc_allowed(TEST_REALLOC))
+        return NULL;
+
+    block_element_t *b = find_header(p);
+    /* find_header() reported it */
+    if (b->magic_header != MAGICHEADER)
+        return NULL;
+
+    if (*find_footer(b) != MAGICFOOTER) {
+        report_event(MSG_ERROR,
+                     "Corruption detected in block with address %p when "
+                     "attempting to reallocate it",
+                     p);
+        error_occurred = true;
+    }
+
+    /* Profiled as a release followed by an allocation at @site. The old
+     * block goes first: once the C library resizes it, its address may be
+     * handed out again.
+     */
+    size_t old_size = b->payload_size;
+    bool profiled = profiling_on();
+    if (profiled)
+        prof_free(b, old_size);
 
-    free(b);
-    allocated_count--;
+    if (size > b->usable) {
+        block_element_t *old = b;
+        if (!b->chunk) {
+            b = large_resize(b, size);
+        } else {
+            critical_enter();
+            thread_cache_t *tc = thread_cache();
+            bool grown = tc && slab_grow(tc, b, size);
+            critical_leave();
+            if (!grown) {
+                void *new = alloc_block(TEST_REALLOC, size, site);
+                if (new) {
+                    memcpy(new, p, old_size);
+                    test_free(p);
+                    return new;
+                }
+                b = NULL;
+            }
+        }
+        if (!b) {
+            if (profiled)
+                prof_alloc(old, old_size, site);
+            return NULL;
+        }
+    }
+    if (profiled)
+        prof_alloc(b, size, site);
+
+    p = &b->payload;
+    if (size > old_size)
+        memset((unsigned char *) p + old_size, FILLCHAR, size - old_size);
+    b->payload_size = size;
+    *find_footer(b) = MAGICFOOTER;
+    return p;
 }
 
 // cppcheck-suppress unusedFunction
@@ -237,7 +1202,89 @@ char *test_strdup(const char *s)
 
 size_t allocation_check()
 {
-    return allocated_count;
+    harness_lock(&tcaches_lock);
+    long n = atomic_load(&retired_allocated);
+    for (thread_cache_t *tc = tcaches; tc; tc = tc->next)
+        n += atomic_load_explicit(&tc->allocated, memory_order_relaxed);
+    harness_unlock(&tcaches_lock);
+    return (size_t) n;
+}
+
+/* Pass the call site of the next allocation */
+void test_site(const char *file, int line)
+{
+    pending_site = (call_site_t){file, line};
+}
+
+/* Turn allocation profiling on or off */
+void set_alloc_profiling(bool on)
+{
+    atomic_store(&profiling, on);
+    if (on)
+        return;
+
+    /* Blocks allocated before profiling is turned on again are not tracked */
+    harness_lock(&prof_lock);
+    free(prof_blocks);
+    prof_blocks = NULL;
+    prof_blocks_mask = prof_blocks_count = 0;
+    prof_live_bytes = 0;
+    for (size_t i = 0; i < prof_nsites; i++)
+        prof_sites[i].live_bytes = 0;
+    harness_unlock(&prof_lock);
+}
+
+/* Forget all profiles, along with the blocks they track */
+void alloc_profile_reset()
+{
+    harness_lock(&prof_lock);
+    free(prof_blocks);
+    prof_blocks = NULL;
+    prof_blocks_mask = prof_blocks_count = 0;
+    memset(prof_index, 0, sizeof(prof_index));
+    prof_nsites = 0;
+    prof_clock = 0;
+    prof_peak_bytes = prof_live_bytes = 0;
+    harness_unlock(&prof_lock);
+}
+
+/* Copy the profiles of up to @n call sites into @sites and the most bytes
+ * live at once into @peak_bytes. Return the number of call sites profiled.
+ */
+size_t alloc_profile(alloc_site_t *sites, size_t n, size_t *peak_bytes)
+{
+    harness_lock(&prof_lock);
+    size_t nsites = prof_nsites;
+    if (n > nsites)
+        n = nsites;
+    if (n)
+        memcpy(sites, prof_sites, n * sizeof(*sites));
+    *peak_bytes = prof_peak_bytes;
+    harness_unlock(&prof_lock);
+    return nsites;
+}
+
+/* Report how allocations of slab-sized blocks by the calling thread were
+ * served since last reset
+ */
+void alloc_cache_stats(size_t *hits, size_t *misses, size_t *cached)
+{
+    thread_cache_t *tc = thread_cache();
+    *hits = *misses = *cached = 0;
+    if (!tc)
+        return;
+    *hits = tc->hits;
+    *misses = tc->misses;
+    for (int k = 0; k < N_SIZE_CLASSES; k++)
+        *cached += tc->size_classes[k].count;
+}
+
+/* Reset the counters reported by alloc_cache_stats() */
+void alloc_cache_reset_stats()
+{
+    thread_cache_t *tc = thread_cache();
+    if (tc)
+        tc->hits = tc->misses = 0;
 }
 
 /* Implementation of functions for testing */
@@ -250,6 +1297,22 @@ void set_cautious_mode(bool cautious)
     cautious_mode = cautious;
 }
 
+/* Set threaded mode, for good.
+ * In this mode, the allocator state shared by threads is locked.
+ */
+void set_threaded_mode()
+{
+    atomic_store(&threaded_mode, true);
+}
+
+/* Set/unset fresh allocation mode, for the calling thread.
+ * In this mode, allocations skip the cache of freed blocks.
+ */
+void set_fresh_mode(bool fresh)
+{
+    alloc_fresh = fresh;
+}
+
 /* Set/unset restricted allocation mode.
  * In this mode, calls to malloc and free are disallowed.
  */
@@ -261,9 +1324,7 @@ void set_noallocate_mode(bool noallocate)
 /* Return whether any errors have occurred since last time set error limit */
 bool error_check()
 {
-    bool e = error_occurred;
-    error_occurred = false;
-    return e;
+    return atomic_exchange(&error_occurred, false);
 }
 
 /* Prepare for a risky operation using setjmp.
@@ -311,6 +1372,10 @@ void trigger_exception(char *msg)
 {
     error_occurred = true;
     error_message = msg;
+    if (critical_depth) {
+        exception_pending = true;
+        return;
+    }
     if (jmp_ready)
         siglongjmp(env, 1);
     else
@@ -8,28 +8,101 @@
 /* This test harness enables us to do stringent testing of code.
  * It overloads the library versions of malloc and free with ones that
  * allow checking for common allocation errors.
+ *
+ * The allocation functions may be called from any thread once threaded mode
+ * is set, and a block may be freed by another thread than the one that
+ * allocated it.
  */
 
 void *test_malloc(size_t size);
 void *test_calloc(size_t nmemb, size_t size);
+void *test_realloc(void *p, size_t size);
 void test_free(void *p);
 char *test_strdup(const char *s);
-/* FIXME: provide test_realloc as well */
+
+/* Pass the call site of the next allocation by the calling thread, for
+ * allocation profiling
+ */
+void test_site(const char *file, int line);
 
 #ifdef INTERNAL
 
 /* Report number of allocated blocks */
 size_t allocation_check();
 
+/* Report how many allocations by the calling thread since the last reset
+ * were served from its cache of freed blocks and how many were not, and how
+ * many blocks it holds
+ */
+void alloc_cache_stats(size_t *hits, size_t *misses, size_t *cached);
+
+/* Reset the counters of the calling thread reported by alloc_cache_stats() */
+void alloc_cache_reset_stats();
+
+/* Number of buckets in the lifetime histogram of a call site */
+#define ALLOC_LIFETIME_BUCKETS 32
+
+/* Profile of the allocations made at one call site.
+ * The lifetime of a block counts the allocations made while it was live:
+ * lifetime[0] counts the blocks freed before any other allocation and
+ * lifetime[i] those that lived through 2^(i-1) to 2^i - 1 allocations, the
+ * last bucket taking in all longer lifetimes.
+ */
+typedef struct {
+    /* NULL with line 0 for allocations that passed no call site, and with
+     * line -1 for the sites past the 255 that are told apart
+     */
+    const char *file;
+    int line;
+    size_t allocs, frees;
+    size_t bytes;      /* Total bytes allocated */
+    size_t live_bytes; /* Bytes in blocks not yet freed */
+    size_t peak_bytes; /* Most bytes live at once */
+    size_t lifetime[ALLOC_LIFETIME_BUCKETS];
+} alloc_site_t;
+
+/* Turn allocation profiling on or off.
+ * Profiles are kept when it is turned off, with no bytes counted as live any
+ * more, and added to when it is turned on again. Blocks allocated while it is
+ * off are left out.
+ */
+void set_alloc_profiling(bool on);
+
+/* Copy the profiles of up to @n call sites into @sites, in order of their
+ * first allocation, and the most bytes live at once over all sites into
+ * @peak_bytes. Return the number of call sites profiled.
+ */
+size_t alloc_profile(alloc_site_t *sites, size_t n, size_t *peak_bytes);
+
+/* Forget all profiles */
+void alloc_profile_reset();
+
 /* Probability of malloc failing, expressed as percent */
 extern int fail_probability;
 
+/* Time limit in seconds for each risky operation, 0 for none */
+extern int time_limit;
+
 /*
  * Set/unset cautious mode.
  * In this mode, makes extra sure any block to be freed is currently allocated.
  */
 void set_cautious_mode(bool cautious);
 
+/*
+ * Set threaded mode, for good.
+ * It must be set before a second thread calls the allocation functions. Until
+ * then the harness takes no locks.
+ */
+void set_threaded_mode();
+
+/*
+ * Set/unset fresh allocation mode, for the calling thread.
+ * In this mode, allocations carve fresh memory, one block after the other,
+ * instead of reusing blocks freed earlier.
+ */
+void set_fresh_mode(bool fresh);
+
 /*
  * Set/unset restricted allocation mode.
  * In this mode, calls to malloc and free are disallowed.
@@ -41,6 +114,10 @@ bool error_check();
 
 /* Prepare for a risky operation using setjmp.
  * Function returns true for initial return, false for error return
+ *
+ * Each thread has its own exception context. The time limit uses alarm(),
+ * which is process-wide: while it runs, threads other than the one that set
+ * it up must block SIGALRM.
  */
 bool exception_setup(bool limit_time);
 
@@ -53,14 +130,18 @@ void trigger_exception(char *msg);
 
 #else /* !INTERNAL */
 
-/* Tested program use our versions of malloc and free */
-#define malloc test_malloc
-#define calloc test_calloc
+/* Tested program use our versions of malloc and free. Allocations pass
+ * their call site for profiling.
+ */
+#define malloc(size) (test_site(__FILE__, __LINE__), test_malloc(size))
+#define calloc(nmemb, size) \
+    (test_site(__FILE__, __LINE__), test_calloc(nmemb, size))
+#define realloc(p, size) (test_site(__FILE__, __LINE__), test_realloc(p, size))
 #define free test_free
 
 /* Use undef to avoid strdup redefined error */
 #undef strdup
-#define strdup test_strdup
+#define strdup(s) (test_site(__FILE__, __LINE__), test_strdup(s))
 
 #endif
 
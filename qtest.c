@@ -43,6 +43,7 @@ extern int show_entropy;
  * solution code
  */
 #include "queue.h"
+#include "queue_ext.h"
 
 #include "console.h"
 #include "report.h"
@@ -53,7 +54,6 @@ extern int show_entropy;
 
 /* How large is a queue before it's considered big.
  * This affects how it gets printed
- * and whether cautious mode is used when freeing the queue
  */
 #define BIG_LIST_SIZE 30
 
@@ -75,8 +75,54 @@ static int string_length = MAXSTRING;
 
 static int descend = 0;
 
+/* Orders selectable with 'option order', indexed by its value */
+static const q_cmp_t order_cmps[] = {
+    q_cmp_lex,
+    q_cmp_num,
+    q_cmp_case,
+    q_cmp_len,
+};
+#define N_ORDERS (int) (sizeof(order_cmps) / sizeof(order_cmps[0]))
+static int order = 0;
+
+/* Sorting engines selectable with 'option sortalgo' */
+enum { SORT_MERGE, SORT_RADIX, N_SORTALGOS };
+static int sortalgo = SORT_MERGE;
+
+/* Queues of at least 'sortparsize' elements are sorted on 'sortthreads'
+ * threads with q_sort_parallel()
+ */
+static int sort_threads = 1;
+static int sort_par_size = 100000;
+
+/* 'reverse' only flips the direction of the queue with q_reverse_lazy() */
+static int lazy_reverse = 0;
+
+/* Positional commands run on queues with a skip-list index */
+static int use_index = 0;
+
+/* 'ih' and 'it' with a count insert through q_insert_{head,tail}_bulk() */
+static int bulk_insert = 0;
+
+/* Positional commands check their result against a walk of the list on
+ * queues up to this size
+ */
+#define POS_CHECK_SIZE 1024
+
+/* Merging strategies selectable with 'option mergealgo' */
+enum { MERGE_HEAP, MERGE_PAIRWISE, N_MERGEALGOS };
+static int mergealgo = MERGE_HEAP;
+
+/* Allocations by the queue code are profiled by call site */
+static int memprof = 0;
+
+/* Call sites shown by 'memstat', those allocating the most bytes first */
+#define MEMSTAT_SITES 10
+
 #define MIN_RANDSTR_LEN 5
 #define MAX_RANDSTR_LEN 10
+/* Strings handed to q_insert_{head,tail}_bulk() per call */
+#define INSERT_BATCH 256
 static const char charset[] = "abcdefghijklmnopqrstuvwxyz";
 /* For queue_insert and queue_remove */
 typedef enum {
@@ -86,22 +132,32 @@ typedef enum {
 /* Forward declarations */
 static bool q_show(int vlevel);
 
-void q_shuffle(struct list_head *head)
+/* Whether the @pos end of queue @q is the last node of its list, which is not
+ * the case while a lazy reversal is pending.
+ */
+static inline bool at_list_end(struct list_head *q, position_t pos)
 {
-    if (!head || list_empty(head) || head->next == head->prev)
-        return;
+    return (pos == POS_TAIL) != q_is_reversed(q);
+}
 
-    int qsize = q_size(head);
-    if (qsize < 2)
-        return;
+bool q_shuffle(struct list_head *head)
+{
+    if (!head || list_empty(head) || head->next == head->prev)
+        return true;
 
-    element_t **arr = malloc(qsize * sizeof(element_t *));
+    /* The array is allocated before the queue is touched, so a failed
+     * allocation leaves it as it was
+     */
+    size_t qsize = q_size(head);
+    test_site(__FILE__, __LINE__);
+    element_t **arr = test_malloc(qsize * sizeof(element_t *));
     if (!arr)
-        return;
+        return false;
 
-    struct list_head *cur = head->next;
-    for (int i = 0; i < qsize; i++, cur = cur->next)
-        arr[i] = list_entry(cur, element_t, list);
+    size_t n = 0;
+    struct list_head *cur;
+    list_for_each(cur, head)
+        arr[n++] = list_entry(cur, element_t, list);
 
     // Fisher-Yates shuffle
     for (int i = qsize - 1; i > 0; i--) {
@@ -116,11 +172,13 @@ void q_shuffle(struct list_head *head)
 
     // **重新組裝洗牌後的鏈結串列**
     INIT_LIST_HEAD(head);
-    for (int i = 0; i < qsize; i++)
+    for (size_t i = 0; i < qsize; i++)
         list_add_tail(&arr[i]->list, head);
+    q_index_invalidate(head);
 
     q_show(3);
-    free(arr);
+    test_free(arr);
+    return true;
 }
 
 static bool do_shuffle(int argc, char *argv[])
@@ -130,10 +188,199 @@ static bool do_shuffle(int argc, char *argv[])
         return false;
     }
 
-    q_shuffle(current->q);
+    if (!q_shuffle(current->q)) {
+        fail_count++;
+        if (fail_count < fail_limit)
+            report(2, "Shuffle failed");
+        else {
+            report(1, "ERROR: Shuffle failed (%d failures total)", fail_count);
+            return false;
+        }
+    }
     return true;
 }
 
+/* Order-sensitive digest of the strings in queue @q, in queue order */
+static uint64_t queue_digest(struct list_head *q)
+{
+    bool back = q_is_reversed(q);
+    uint64_t h = 0xcbf29ce484222325ULL; /* FNV-1a */
+    for (struct list_head *node = back ? q->prev : q->next; node != q;
+         node = back ? node->prev : node->next) {
+        /* The terminating NUL separates consecutive strings */
+        const char *c = list_entry(node, element_t, list)->value;
+        do {
+            h ^= (unsigned char) *c;
+            h *= 0x100000001b3ULL;
+        } while (*c++);
+    }
+    return h;
+}
+
+static bool do_compact(int argc, char *argv[])
+{
+    if (argc != 1) {
+        report(1, "%s takes no arguments", argv[0]);
+        return false;
+    }
+
+    if (!current || !current->q) {
+        report(3, "Warning: Try to access null queue");
+        return false;
+    }
+    error_check();
+
+    uint64_t digest = queue_digest(current->q);
+
+    /* The copies must come from fresh memory: blocks freed by the
+     * compaction, or earlier, would otherwise be reused and scatter the
+     * queue again
+     */
+    set_fresh_mode(true);
+    if (exception_setup(true) && !q_compact(current->q))
+        report(2, "Compaction stopped on a failed allocation");
+    exception_cancel();
+    set_fresh_mode(false);
+
+    bool ok = true;
+    if (q_size(current->q) != current->size ||
+        queue_digest(current->q) != digest) {
+        report(1, "ERROR: Compaction changed the contents of queue");
+        ok = false;
+    }
+
+    q_show(3);
+    return ok && !error_check();
+}
+
+static bool do_cachestat(int argc, char *argv[])
+{
+    bool reset = argc == 2 && strcmp(argv[1], "-r") == 0;
+    if (argc != 1 && !reset) {
+        report(1, "%s takes no arguments other than -r", argv[0]);
+        return false;
+    }
+
+    size_t hits, misses, cached;
+    alloc_cache_stats(&hits, &misses, &cached);
+    size_t total = hits + misses;
+    report(1, "Block cache: %zu hits, %zu misses (%.1f%% hit rate), %zu cached",
+           hits, misses, total ? 100.0 * hits / total : 0.0, cached);
+    if (reset)
+        alloc_cache_reset_stats();
+    return true;
+}
+
+/* Fetch the profiles of all call sites into a new array, returning their
+ * number in @n, or NULL if it cannot be allocated
+ */
+static alloc_site_t *fetch_alloc_profile(size_t *n, size_t *peak_bytes)
+{
+    *n = alloc_profile(NULL, 0, peak_bytes);
+    alloc_site_t *sites = malloc((*n ? *n : 1) * sizeof(*sites));
+    if (sites)
+        *n = alloc_profile(sites, *n, peak_bytes);
+    return sites;
+}
+
+/* Name of the call site of @s, as file:line */
+static const char *site_name(const alloc_site_t *s, char *buf, size_t len)
+{
+    if (!s->file)
+        return s->line < 0 ? "(other)" : "(unknown)";
+    snprintf(buf, len, "%s:%d", s->file, s->line);
+    return buf;
+}
+
+static int site_bytes_cmp(const void *a, const void *b)
+{
+    const alloc_site_t *x = a, *y = b;
+    return (x->bytes < y->bytes) - (x->bytes > y->bytes);
+}
+
+static bool do_memstat(int argc, char *argv[])
+{
+    bool reset = argc == 2 && strcmp(argv[1], "-r") == 0;
+    if (argc != 1 && !reset) {
+        report(1, "%s takes no arguments other than -r", argv[0]);
+        return false;
+    }
+    if (!memprof)
+        report(1, "Warning: Allocation profiling is off, see 'option memprof'");
+
+    size_t n, peak;
+    alloc_site_t *sites = fetch_alloc_profile(&n, &peak);
+    if (!sites) {
+        report(1, "ERROR: Could not allocate the profiles");
+        return false;
+    }
+    qsort(sites, n, sizeof(*sites), site_bytes_cmp);
+
+    report(1, "Allocation profile: %zu call sites, peak of %zu bytes live", n,
+           peak);
+    for (size_t i = 0; i < n && i < MEMSTAT_SITES; i++) {
+        const alloc_site_t *s = &sites[i];
+        char name[256];
+        report(1,
+               "  %-24s %zu allocs, %zu frees, %zu bytes, %zu live, %zu peak",
+               site_name(s, name, sizeof(name)), s->allocs, s->frees, s->bytes,
+               s->live_bytes, s->peak_bytes);
+
+        /* Lifetimes, in allocations made while a block was live */
+        char hist[512];
+        size_t len = 0;
+        for (int k = 0; k < ALLOC_LIFETIME_BUCKETS && len < sizeof(hist);
+             k++) {
+            if (!s->lifetime[k])
+                continue;
+            len += snprintf(hist + len, sizeof(hist) - len, " %s%zu:%zu",
+                            k == ALLOC_LIFETIME_BUCKETS - 1 ? ">=" : "<",
+                            k == ALLOC_LIFETIME_BUCKETS - 1
+                                ? (size_t) 1 << (k - 1)
+                                : (size_t) 1 << k,
+                            s->lifetime[k]);
+        }
+        if (len)
+            report(1, "    lifetimes%s", hist);
+    }
+    free(sites);
+
+    if (reset)
+        alloc_profile_reset();
+    return true;
+}
+
+/* Write the allocation profiles to @path as JSON */
+static bool write_alloc_profile(const char *path)
+{
+    size_t n, peak;
+    alloc_site_t *sites = fetch_alloc_profile(&n, &peak);
+    FILE *f = sites ? fopen(path, "w") : NULL;
+    if (!f) {
+        free(sites);
+        report(1, "ERROR: Could not write allocation profile to '%s'", path);
+        return false;
+    }
+
+    fprintf(f, "{\"peak_bytes\": %zu, \"sites\": [", peak);
+    for (size_t i = 0; i < n; i++) {
+        const alloc_site_t *s = &sites[i];
+        char name[256];
+        fprintf(f,
+                "%s\n  {\"site\": \"%s\", \"allocs\": %zu, \"frees\": %zu, "
+                "\"bytes\": %zu, \"live_bytes\": %zu, \"peak_bytes\": %zu, "
+                "\"lifetime\": [",
+                i ? "," : "", site_name(s, name, sizeof(name)), s->allocs,
+                s->frees, s->bytes, s->live_bytes, s->peak_bytes);
+        for (int k = 0; k < ALLOC_LIFETIME_BUCKETS; k++)
+            fprintf(f, "%s%zu", k ? ", " : "", s->lifetime[k]);
+        fprintf(f, "]}");
+    }
+    fprintf(f, "\n]}\n");
+    free(sites);
+    return fclose(f) == 0;
+}
+
 static bool do_free(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -149,9 +396,6 @@ static bool do_free(int argc, char *argv[])
     }
     error_check();
 
-    if (current && current->size > BIG_LIST_SIZE)
-        set_cautious_mode(false);
-
     struct list_head *qnext = NULL;
     if (chain.size > 1) {
         qnext = (current->chain.next == &chain.head) ? chain.head.next
@@ -164,7 +408,6 @@ static bool do_free(int argc, char *argv[])
         if (exception_setup(true))
             q_free(current->q);
         exception_cancel();
-        set_cautious_mode(true);
     }
 
     if (current) {
@@ -229,6 +472,80 @@ static void fill_rand_string(char *buf, size_t buf_size)
 }
 
 /* insertion */
+/* Insert @reps copies of @inserts, or random strings when @need_rand, through
+ * q_insert_{head,tail}_bulk() in batches of INSERT_BATCH, checking the new
+ * elements as queue_insert() does.
+ */
+static bool queue_insert_bulk(position_t pos,
+                              char *inserts,
+                              bool need_rand,
+                              int reps)
+{
+    char randstr_bufs[INSERT_BATCH][MAX_RANDSTR_LEN];
+    char *strs[INSERT_BATCH];
+    char *lasts = NULL;
+    bool ok = true;
+
+    for (int r = 0; ok && r < reps;) {
+        int n = reps - r < INSERT_BATCH ? reps - r : INSERT_BATCH;
+        for (int i = 0; i < n; i++) {
+            if (need_rand) {
+                fill_rand_string(randstr_bufs[i], sizeof(randstr_bufs[i]));
+                strs[i] = randstr_bufs[i];
+            } else {
+                strs[i] = inserts;
+            }
+        }
+
+        int count = pos == POS_TAIL ? q_insert_tail_bulk(current->q, strs, n)
+                                    : q_insert_head_bulk(current->q, strs, n);
+        current->size += count;
+
+        /* The new elements, walked from the end they were inserted at, come
+         * in reverse order of insertion.
+         */
+        bool back = at_list_end(current->q, pos);
+        struct list_head *node = back ? current->q->prev : current->q->next;
+        for (int i = count - 1; i >= 0; i--) {
+            char *cur_inserts = list_entry(node, element_t, list)->value;
+            if (!cur_inserts) {
+                report(1, "ERROR: Failed to save copy of string in queue");
+                ok = false;
+                break;
+            } else if (cur_inserts == strs[i]) {
+                report(1,
+                       "ERROR: Need to allocate and copy string for new "
+                       "queue element");
+                ok = false;
+                break;
+            } else if (cur_inserts == lasts) {
+                report(1,
+                       "ERROR: Need to allocate separate string for each "
+                       "queue element");
+                ok = false;
+                break;
+            }
+            lasts = cur_inserts;
+            node = back ? node->prev : node->next;
+        }
+        r += count;
+
+        if (ok && count < n) {
+            r++;
+            fail_count++;
+            if (fail_count < fail_limit)
+                report(2, "Insertion of %s failed", strs[count]);
+            else {
+                report(1, "ERROR: Insertion of %s failed (%d failures total)",
+                       strs[count], fail_count);
+                ok = false;
+            }
+        }
+        ok = ok && !error_check();
+    }
+    return ok;
+}
+
 static bool queue_insert(position_t pos, int argc, char *argv[])
 {
     if (simulation) {
@@ -274,7 +591,9 @@ static bool queue_insert(position_t pos, int argc, char *argv[])
                pos == POS_TAIL ? "tail" : "head");
     error_check();
 
-    if (current && exception_setup(true)) {
+    if (current && argc == 3 && bulk_insert && exception_setup(true)) {
+        ok = queue_insert_bulk(pos, inserts, need_rand, reps);
+    } else if (current && exception_setup(true)) {
         for (int r = 0; ok && r < reps; r++) {
             if (need_rand)
                 fill_rand_string(randstr_buf, sizeof(randstr_buf));
@@ -283,7 +602,7 @@ static bool queue_insert(position_t pos, int argc, char *argv[])
             if (rval) {
                 current->size++;
                 element_t *entry =
-                    pos == POS_TAIL
+                    at_list_end(current->q, pos)
                         ? list_last_entry(current->q, element_t, list)
                         : list_first_entry(current->q, element_t, list);
                 char *cur_inserts = entry->value;
@@ -336,6 +655,60 @@ static bool do_it(int argc, char *argv[])
     return queue_insert(POS_TAIL, argc, argv);
 }
 
+/* Remove @argv[2] elements at once through q_remove_{head,tail}_bulk() and
+ * compare each of them to the expected value @argv[1].
+ */
+static bool queue_remove_bulk(position_t pos, char *argv[])
+{
+    int reps;
+    if (!get_int(argv[2], &reps) || reps < 1) {
+        report(1, "Invalid number of removals '%s'", argv[2]);
+        return false;
+    }
+
+    if (!current || !current->size)
+        report(3, "Warning: Calling remove %s on empty queue",
+               pos == POS_TAIL ? "tail" : "head");
+    error_check();
+
+    LIST_HEAD(removed);
+    int count = 0;
+    if (current && exception_setup(true))
+        count = pos == POS_TAIL
+                    ? q_remove_tail_bulk(current->q, &removed, reps)
+                    : q_remove_head_bulk(current->q, &removed, reps);
+    exception_cancel();
+    if (current)
+        current->size -= count;
+
+    bool ok = true;
+    int n = 0;
+    element_t *item, *tmp;
+    list_for_each_entry_safe(item, tmp, &removed, list) {
+        if (ok && strcmp(item->value, argv[1])) {
+            report(1, "ERROR: Removed value %s != expected value %s",
+                   item->value, argv[1]);
+            ok = false;
+        }
+        list_del(&item->list);
+        q_release_element(item);
+        n++;
+    }
+
+    if (n != count) {
+        report(1, "ERROR: Removed %d elements but reported %d", n, count);
+        ok = false;
+    } else if (count < reps) {
+        fail_count++;
+        report(1, "ERROR: Removal from queue failed (%d failures total)",
+               fail_count);
+        ok = false;
+    }
+
+    q_show(3);
+    return ok && !error_check();
+}
+
 static bool queue_remove(position_t pos, int argc, char *argv[])
 {
     /* FIXME: It is known that both functions is_remove_tail_const() and
@@ -360,11 +733,14 @@ static bool queue_remove(position_t pos, int argc, char *argv[])
     }
 #endif
 
-    if (argc != 1 && argc != 2) {
-        report(1, "%s needs 0-1 arguments", argv[0]);
+    if (argc != 1 && argc != 2 && argc != 3) {
+        report(1, "%s needs 0-2 arguments", argv[0]);
         return false;
     }
 
+    if (argc == 3)
+        return queue_remove_bulk(pos, argv);
+
     char *removes = malloc(string_length + STRINGPAD + 1);
     if (!removes) {
         report(1,
@@ -465,10 +841,81 @@ static inline bool do_rt(int argc, char *argv[])
     return queue_remove(POS_TAIL, argc, argv);
 }
 
+/* Reference check for 'dedup -h': values occurring more than once in
+ * @l_copy, the queue before deduplication, are found by sorting references
+ * to them, then the survivors are matched against the current queue in their
+ * original order.
+ */
+typedef struct {
+    const char *value;
+    int idx;
+} dedup_ref_t;
+
+static int dedup_ref_cmp(const void *a, const void *b)
+{
+    const dedup_ref_t *x = a, *y = b;
+    int cmp = strcmp(x->value, y->value);
+    if (cmp)
+        return cmp;
+    return x->idx - y->idx;
+}
+
+static bool check_dedup_hash(struct list_head *l_copy, int n)
+{
+    dedup_ref_t *refs = malloc(sizeof(dedup_ref_t) * (n ? n : 1));
+    bool *is_dup = calloc(n ? n : 1, sizeof(bool));
+    if (!refs || !is_dup) {
+        free(refs);
+        free(is_dup);
+        report(1, "INTERNAL ERROR.  Could not allocate space for duplicate "
+                  "checking");
+        return false;
+    }
+
+    element_t *item;
+    int i = 0;
+    list_for_each_entry(item, l_copy, list) {
+        refs[i].value = item->value;
+        refs[i].idx = i;
+        i++;
+    }
+    qsort(refs, n, sizeof(dedup_ref_t), dedup_ref_cmp);
+    for (i = 1; i < n; i++) {
+        if (strcmp(refs[i - 1].value, refs[i].value) == 0)
+            is_dup[refs[i - 1].idx] = is_dup[refs[i].idx] = true;
+    }
+
+    bool ok = true;
+    struct list_head *l_tmp = current->q->next;
+    i = 0;
+    list_for_each_entry(item, l_copy, list) {
+        if (is_dup[i++]) {
+            current->size--;
+        } else if (l_tmp != current->q &&
+                   strcmp(list_entry(l_tmp, element_t, list)->value,
+                          item->value) == 0) {
+            l_tmp = l_tmp->next;
+        } else {
+            ok = false;
+            break;
+        }
+    }
+    ok = ok && l_tmp == current->q;
+    if (!ok)
+        report(1,
+               "ERROR: Duplicate strings are in queue or distinct strings are "
+               "not in queue");
+
+    free(refs);
+    free(is_dup);
+    return ok;
+}
+
 static bool do_dedup(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    bool hash = argc == 2 && strcmp(argv[1], "-h") == 0;
+    if (argc != 1 && !hash) {
+        report(1, "%s takes no arguments other than -h", argv[0]);
         return false;
     }
 
@@ -477,6 +924,9 @@ static bool do_dedup(int argc, char *argv[])
         return false;
     }
 
+    /* The copy below is checked against in list order */
+    q_materialize(current->q);
+
     LIST_HEAD(l_copy);
     element_t *item = NULL, *tmp = NULL;
 
@@ -512,7 +962,7 @@ static bool do_dedup(int argc, char *argv[])
 
     bool ok = true;
     if (exception_setup(true))
-        ok = q_delete_dup(current->q);
+        ok = hash ? q_delete_dup_hash(current->q) : q_delete_dup(current->q);
     exception_cancel();
 
     if (!ok) {
@@ -524,6 +974,16 @@ static bool do_dedup(int argc, char *argv[])
         return false;
     }
 
+    if (hash) {
+        ok = check_dedup_hash(&l_copy, current->size);
+        list_for_each_entry_safe(item, tmp, &l_copy, list) {
+            free(item->value);
+            free(item);
+        }
+        q_show(3);
+        return ok && !error_check();
+    }
+
     struct list_head *l_tmp = current->q->next;
     bool is_this_dup = false;
     // Compare between new list and old one
@@ -572,8 +1032,12 @@ static bool do_reverse(int argc, char *argv[])
     error_check();
 
     set_noallocate_mode(true);
-    if (current && exception_setup(true))
-        q_reverse(current->q);
+    if (current && exception_setup(true)) {
+        if (lazy_reverse)
+            q_reverse_lazy(current->q);
+        else
+            q_reverse(current->q);
+    }
     exception_cancel();
 
     set_noallocate_mode(false);
@@ -650,6 +1114,8 @@ bool do_sort(int argc, char *argv[])
 #define MAX_NODES 100000
     struct list_head *nodes[MAX_NODES];
     unsigned no = 0;
+    if (current && current->q)
+        q_materialize(current->q);
     if (current && current->size && current->size <= MAX_NODES) {
         element_t *entry;
         list_for_each_entry(entry, current->q, list)
@@ -660,8 +1126,26 @@ bool do_sort(int argc, char *argv[])
                "number of elements %d is too large, exceeds the limit %d.",
                current->size, MAX_NODES);
 
-    if (current && exception_setup(true))
-        q_sort(current->q, descend);
+    bool parallel =
+        current && sort_threads > 1 && current->size >= sort_par_size;
+    if (sortalgo == SORT_RADIX && parallel)
+        report(1,
+               "Warning: Sorting on multiple threads only supports merge "
+               "sort, ignoring radix sort");
+    else if (sortalgo == SORT_RADIX && order_cmps[order] != q_cmp_lex)
+        report(1,
+               "Warning: Radix sort only supports lexicographic order, "
+               "falling back to merge sort");
+
+    if (current && exception_setup(true)) {
+        if (parallel)
+            q_sort_parallel(current->q, order_cmps[order], descend,
+                            sort_threads);
+        else if (sortalgo == SORT_RADIX && order_cmps[order] == q_cmp_lex)
+            q_sort_radix(current->q, descend);
+        else
+            q_sort_cmp(current->q, order_cmps[order], descend);
+    }
     exception_cancel();
     set_noallocate_mode(false);
 
@@ -673,20 +1157,20 @@ bool do_sort(int argc, char *argv[])
             element_t *item, *next_item;
             item = list_entry(cur_l, element_t, list);
             next_item = list_entry(cur_l->next, element_t, list);
-            if (!descend && strcmp(item->value, next_item->value) > 0) {
+            int cmp = order_cmps[order](item->value, next_item->value);
+            if (!descend && cmp > 0) {
                 report(1, "ERROR: Not sorted in ascending order");
                 ok = false;
                 break;
             }
 
-            if (descend && strcmp(item->value, next_item->value) < 0) {
+            if (descend && cmp < 0) {
                 report(1, "ERROR: Not sorted in descending order");
                 ok = false;
                 break;
             }
             /* Ensure the stability of the sort */
-            if (current->size <= MAX_NODES &&
-                !strcmp(item->value, next_item->value)) {
+            if (current->size <= MAX_NODES && !cmp) {
                 bool unstable = false;
                 for (unsigned i = 0; i < MAX_NODES; i++) {
                     if (nodes[i] == cur_l->next) {
@@ -741,87 +1225,245 @@ static bool do_dm(int argc, char *argv[])
     return ok && !error_check();
 }
 
-static bool do_swap(int argc, char *argv[])
+/* Element at position @k of queue @q, found by walking its list */
+static element_t *walk_to_pos(struct list_head *q, int k)
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    bool back = q_is_reversed(q);
+    struct list_head *node = q;
+    for (int i = 0; i <= k; i++)
+        node = back ? node->prev : node->next;
+    return list_entry(node, element_t, list);
+}
+
+/* Draw a random position in [0, @n) */
+static int rand_pos_below(int n)
+{
+    if (n < 1)
+        return 0;
+    uint32_t r;
+    randombytes((uint8_t *) &r, sizeof(r));
+    return r % n;
+}
+
+/* Parse the arguments of a positional command taking @nargs - 1 arguments
+ * and an optional count. The position is either a number or RAND for one
+ * drawn anew for each repetition.
+ */
+static bool pos_prepare(int argc,
+                        char *argv[],
+                        int nargs,
+                        int *k,
+                        bool *rand_pos,
+                        int *reps)
+{
+    *reps = 1;
+    if (argc != nargs && argc != nargs + 1) {
+        report(1, "%s needs %d argument(s) and an optional count", argv[0],
+               nargs - 1);
+        return false;
+    }
+    *k = 0;
+    *rand_pos = !strcmp(argv[1], "RAND");
+    if (!*rand_pos && !get_int(argv[1], k)) {
+        report(1, "Invalid position '%s'", argv[1]);
+        return false;
+    }
+    if (argc == nargs + 1 && (!get_int(argv[nargs], reps) || *reps < 1)) {
+        report(1, "Invalid count '%s'", argv[nargs]);
         return false;
     }
-
     if (!current || !current->q) {
         report(3, "Warning: Try to access null queue");
         return false;
     }
+    if (use_index && !q_index_enable(current->q)) {
+        report(1, "ERROR: Could not allocate index");
+        return false;
+    }
+    return true;
+}
+
+static bool do_get(int argc, char *argv[])
+{
+    int k, reps;
+    bool rand_pos;
+    if (!pos_prepare(argc, argv, 2, &k, &rand_pos, &reps))
+        return false;
     error_check();
 
-    set_noallocate_mode(true);
-    if (exception_setup(true))
-        q_swap(current->q);
+    bool ok = true;
+    if (exception_setup(true)) {
+        for (int r = 0; ok && r < reps; r++) {
+            if (rand_pos)
+                k = rand_pos_below(current->size);
+            element_t *e = q_get(current->q, k);
+            if (k < 0 || k >= current->size) {
+                if (e) {
+                    report(1, "ERROR: Got an element at position %d of %d", k,
+                           current->size);
+                    ok = false;
+                }
+                continue;
+            }
+            if (!e) {
+                report(1, "ERROR: No element at position %d", k);
+                ok = false;
+            } else if (current->size <= POS_CHECK_SIZE &&
+                       e != walk_to_pos(current->q, k)) {
+                report(1, "ERROR: Wrong element at position %d", k);
+                ok = false;
+            } else if (reps == 1) {
+                report(2, "Element at position %d: %s", k, e->value);
+            }
+        }
+    }
     exception_cancel();
 
-    set_noallocate_mode(false);
-
-    q_show(3);
-    return !error_check();
+    return ok && !error_check();
 }
 
-
-static bool do_ascend(int argc, char *argv[])
+static bool do_delat(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes too much arguments", argv[0]);
+    int k, reps;
+    bool rand_pos;
+    if (!pos_prepare(argc, argv, 2, &k, &rand_pos, &reps))
         return false;
-    }
+    error_check();
 
-    if (!current || !current->q) {
-        report(3, "Warning: Calling ascend on null queue");
-        return false;
+    bool ok = true;
+    if (exception_setup(true)) {
+        for (int r = 0; ok && r < reps; r++) {
+            if (rand_pos)
+                k = rand_pos_below(current->size);
+            bool in_range = k >= 0 && k < current->size;
+            bool check = in_range && current->size <= POS_CHECK_SIZE;
+            element_t *next = check && k + 1 < current->size
+                                  ? walk_to_pos(current->q, k + 1)
+                                  : NULL;
+
+            bool deleted = q_delete_at(current->q, k);
+            if (deleted != in_range) {
+                report(1, "ERROR: Deletion at position %d of %d %s", k,
+                       current->size, deleted ? "succeeded" : "failed");
+                ok = false;
+                break;
+            }
+            if (!deleted) {
+                report(3, "Warning: No element at position %d", k);
+                continue;
+            }
+            current->size--;
+            if (check && (q_size(current->q) != current->size ||
+                          (next && walk_to_pos(current->q, k) != next))) {
+                report(1, "ERROR: Wrong element deleted at position %d", k);
+                ok = false;
+            }
+        }
     }
-    error_check();
+    exception_cancel();
 
+    q_show(3);
+    return ok && !error_check();
+}
 
-    int cnt = q_size(current->q);
-    if (!cnt)
-        report(3, "Warning: Calling ascend on empty queue");
-    else if (cnt < 2)
-        report(3, "Warning: Calling ascend on single node");
-    error_check();
+static bool do_insat(int argc, char *argv[])
+{
+    int k, reps;
+    bool rand_pos;
+    if (!pos_prepare(argc, argv, 3, &k, &rand_pos, &reps))
+        return false;
 
-    if (exception_setup(true))
-        current->size = q_ascend(current->q);
-    set_noallocate_mode(false);
+    char randstr_buf[MAX_RANDSTR_LEN];
+    bool need_rand = !strcmp(argv[2], "RAND");
+    char *inserts = need_rand ? randstr_buf : argv[2];
+    error_check();
 
     bool ok = true;
+    if (exception_setup(true)) {
+        for (int r = 0; ok && r < reps; r++) {
+            if (rand_pos)
+                k = rand_pos_below(current->size + 1);
+            if (need_rand)
+                fill_rand_string(randstr_buf, sizeof(randstr_buf));
+            bool in_range = k >= 0 && k <= current->size;
 
-    cnt = current->size;
-    if (current->size) {
-        for (struct list_head *cur_l = current->q->next;
-             cur_l != current->q && --cnt; cur_l = cur_l->next) {
-            element_t *item, *next_item;
-            item = list_entry(cur_l, element_t, list);
-            next_item = list_entry(cur_l->next, element_t, list);
-            if (strcmp(item->value, next_item->value) > 0) {
-                report(1,
-                       "ERROR: At least one node violated the ordering rule");
+            if (!q_insert_at(current->q, k, inserts)) {
+                if (!in_range) {
+                    report(3, "Warning: No position %d in queue of %d", k,
+                           current->size);
+                    continue;
+                }
+                fail_count++;
+                if (fail_count < fail_limit) {
+                    report(2, "Insertion of %s failed", inserts);
+                } else {
+                    report(1,
+                           "ERROR: Insertion of %s failed (%d failures total)",
+                           inserts, fail_count);
+                    ok = false;
+                }
+                continue;
+            }
+            if (!in_range) {
+                report(1, "ERROR: Inserted at position %d of %d", k,
+                       current->size);
                 ok = false;
                 break;
             }
+            current->size++;
+            if (current->size <= POS_CHECK_SIZE) {
+                element_t *e = walk_to_pos(current->q, k);
+                if (q_size(current->q) != current->size ||
+                    strcmp(e->value, inserts)) {
+                    report(1, "ERROR: Wrong element inserted at position %d",
+                           k);
+                    ok = false;
+                }
+            }
         }
     }
+    exception_cancel();
 
     q_show(3);
     return ok && !error_check();
 }
 
-static bool do_descend(int argc, char *argv[])
+static bool do_swap(int argc, char *argv[])
 {
     if (argc != 1) {
+        report(1, "%s takes no arguments", argv[0]);
+        return false;
+    }
+
+    if (!current || !current->q) {
+        report(3, "Warning: Try to access null queue");
+        return false;
+    }
+    error_check();
+
+    set_noallocate_mode(true);
+    if (exception_setup(true))
+        q_swap(current->q);
+    exception_cancel();
+
+    set_noallocate_mode(false);
+
+    q_show(3);
+    return !error_check();
+}
+
+
+static bool queue_monotonic(bool desc, int argc, char *argv[])
+{
+    const char *name = desc ? "descend" : "ascend";
+    bool collect = argc == 2 && strcmp(argv[1], "-c") == 0;
+    if (argc != 1 && !collect) {
         report(1, "%s takes too much arguments", argv[0]);
         return false;
     }
 
     if (!current || !current->q) {
-        report(3, "Warning: Calling descend on null queue");
+        report(3, "Warning: Calling %s on null queue", name);
         return false;
     }
     error_check();
@@ -829,25 +1471,47 @@ static bool do_descend(int argc, char *argv[])
 
     int cnt = q_size(current->q);
     if (!cnt)
-        report(3, "Warning: Calling descend on empty queue");
+        report(3, "Warning: Calling %s on empty queue", name);
     else if (cnt < 2)
-        report(3, "Warning: Calling descend on single node");
+        report(3, "Warning: Calling %s on single node", name);
     error_check();
 
-    if (exception_setup(true))
-        current->size = q_descend(current->q);
-    set_noallocate_mode(false);
+    LIST_HEAD(removed);
+    int before = current->size;
+    if (exception_setup(true)) {
+        if (collect)
+            current->size = desc ? q_descend_collect(current->q, &removed)
+                                 : q_ascend_collect(current->q, &removed);
+        else
+            current->size = desc ? q_descend(current->q) : q_ascend(current->q);
+    }
+    exception_cancel();
 
     bool ok = true;
+    if (collect) {
+        int n = 0;
+        element_t *item, *tmp;
+        list_for_each_entry_safe(item, tmp, &removed, list) {
+            list_del(&item->list);
+            q_release_element(item);
+            n++;
+        }
+        if (n != before - current->size) {
+            report(1, "ERROR: Collected %d elements but %d were removed", n,
+                   before - current->size);
+            ok = false;
+        }
+    }
 
     cnt = current->size;
-    if (current->size) {
+    if (ok && current->size) {
         for (struct list_head *cur_l = current->q->next;
              cur_l != current->q && --cnt; cur_l = cur_l->next) {
             element_t *item, *next_item;
             item = list_entry(cur_l, element_t, list);
             next_item = list_entry(cur_l->next, element_t, list);
-            if (strcmp(item->value, next_item->value) < 0) {
+            int cmp = strcmp(item->value, next_item->value);
+            if (desc ? cmp < 0 : cmp > 0) {
                 report(1,
                        "ERROR: At least one node violated the ordering rule");
                 ok = false;
@@ -860,34 +1524,89 @@ static bool do_descend(int argc, char *argv[])
     return ok && !error_check();
 }
 
-static bool do_reverseK(int argc, char *argv[])
+static bool do_ascend(int argc, char *argv[])
 {
-    int k = 0;
+    return queue_monotonic(false, argc, argv);
+}
 
+static bool do_descend(int argc, char *argv[])
+{
+    return queue_monotonic(true, argc, argv);
+}
+
+static bool do_reverseK(int argc, char *argv[])
+{
     if (!current || !current->q) {
         report(3, "Warning: Calling reverseK on null queue");
         return false;
     }
     error_check();
 
-    if (argc == 2) {
-        if (!get_int(argv[1], &k) || k < 1) {
+    if (argc < 2) {
+        report(1, "Invalid number of arguments for reverseK");
+        return false;
+    }
+
+    int nk = argc - 1;
+    int *ks = malloc(sizeof(int) * nk);
+    /* Elements in their expected order, to check the result against */
+    element_t **expect = malloc(sizeof(element_t *) * (current->size + 1));
+    if (!ks || !expect) {
+        free(ks);
+        free(expect);
+        report(1, "INTERNAL ERROR.  Could not allocate space for reverseK");
+        return false;
+    }
+
+    for (int j = 0; j < nk; j++) {
+        if (!get_int(argv[j + 1], &ks[j]) || ks[j] < 1) {
             report(1, "Invalid number of K (at least 1)");
+            free(ks);
+            free(expect);
             return false;
         }
-    } else {
-        report(1, "Invalid number of arguments for reverseK");
-        return false;
+    }
+
+    int n = 0;
+    element_t *item;
+    q_materialize(current->q);
+    list_for_each_entry(item, current->q, list)
+        expect[n++] = item;
+    for (int j = 0; j < nk; j++) {
+        for (int g = 0; g + ks[j] <= n; g += ks[j]) {
+            for (int l = g, r = g + ks[j] - 1; l < r; l++, r--) {
+                element_t *tmp = expect[l];
+                expect[l] = expect[r];
+                expect[r] = tmp;
+            }
+        }
     }
 
     set_noallocate_mode(true);
-    if (exception_setup(true))
-        q_reverseK(current->q, k);
+    if (exception_setup(true)) {
+        if (nk == 1)
+            q_reverseK(current->q, ks[0]);
+        else
+            q_reverseK_many(current->q, ks, nk);
+    }
     exception_cancel();
-
     set_noallocate_mode(false);
+
+    bool ok = true;
+    int i = 0;
+    list_for_each_entry(item, current->q, list) {
+        if (i == n || item != expect[i++]) {
+            ok = false;
+            break;
+        }
+    }
+    if (!ok || i != n)
+        report(1, "ERROR: Nodes are not reversed in groups of K");
+
+    free(ks);
+    free(expect);
     q_show(3);
-    return !error_check();
+    return ok && i == n && !error_check();
 }
 
 static bool do_merge(int argc, char *argv[])
@@ -906,11 +1625,13 @@ static bool do_merge(int argc, char *argv[])
     int len = 0;
     set_noallocate_mode(true);
     if (current && exception_setup(true))
-        len = q_merge(&chain.head, descend);
+        len = mergealgo == MERGE_PAIRWISE
+                  ? q_merge_pairwise(&chain.head, order_cmps[order], descend)
+                  : q_merge_cmp(&chain.head, order_cmps[order], descend);
     exception_cancel();
     set_noallocate_mode(false);
 
-    if (q_size(&chain.head) > 1) {
+    if (chain.size > 1) {
         chain.size = 1;
         current = list_entry(chain.head.next, queue_contex_t, chain);
         current->size = len;
@@ -935,7 +1656,8 @@ static bool do_merge(int argc, char *argv[])
             element_t *item, *next_item;
             item = list_entry(cur_l, element_t, list);
             next_item = list_entry(cur_l->next, element_t, list);
-            if (!descend && strcmp(item->value, next_item->value) > 0) {
+            int cmp = order_cmps[order](item->value, next_item->value);
+            if (!descend && cmp > 0) {
                 report(1,
                        "ERROR: Not sorted in ascending order (It might because "
                        "of unsorted queues are merged or there're some flaws "
@@ -945,7 +1667,7 @@ static bool do_merge(int argc, char *argv[])
             }
 
 
-            if (descend && strcmp(item->value, next_item->value) < 0) {
+            if (descend && cmp < 0) {
                 report(
                     1,
                     "ERROR: Not sorted in descending order (It might because "
@@ -1005,7 +1727,8 @@ static bool q_show(int vlevel)
     report_noreturn(vlevel, "l = [");
 
     struct list_head *ori = current->q;
-    struct list_head *cur = current->q->next;
+    bool back = q_is_reversed(current->q);
+    struct list_head *cur = back ? current->q->prev : current->q->next;
 
     if (exception_setup(true)) {
         while (ok && ori != cur && cnt < current->size) {
@@ -1019,7 +1742,7 @@ static bool q_show(int vlevel)
                 }
             }
             cnt++;
-            cur = cur->next;
+            cur = back ? cur->prev : cur->next;
             ok = ok && !error_check();
         }
     }
@@ -1104,12 +1827,113 @@ static bool do_next(int argc, char *argv[])
     return q_show(0);
 }
 
+/* Move strings from the head of the current queue to the tail of the next
+ * one without copying them, and check that each one arrives as is.
+ */
+static bool do_move(int argc, char *argv[])
+{
+    int reps = 1;
+    if (argc > 2 || (argc == 2 && (!get_int(argv[1], &reps) || reps < 1))) {
+        report(1, "%s takes an optional positive count", argv[0]);
+        return false;
+    }
+
+    if (!current || chain.size < 2) {
+        report(3, "Warning: Moving needs at least two queues");
+        return false;
+    }
+    error_check();
+
+    struct list_head *next = chain.head.prev == &current->chain
+                                 ? chain.head.next
+                                 : current->chain.next;
+    queue_contex_t *to = list_entry(next, queue_contex_t, chain);
+
+    bool ok = true;
+    if (exception_setup(true)) {
+        for (int r = 0; ok && r < reps; r++) {
+            element_t *e = q_remove_head(current->q, NULL, 0);
+            if (!e) {
+                report(1, "ERROR: Removal from queue failed");
+                ok = false;
+                break;
+            }
+            current->size--;
+
+            char *s = q_unwrap_element(e);
+            if (!q_insert_tail_adopt(to->q, s)) {
+                fail_count++;
+                if (fail_count < fail_limit)
+                    report(2, "Insertion of %s failed", s);
+                else {
+                    report(1,
+                           "ERROR: Insertion of %s failed (%d failures total)",
+                           s, fail_count);
+                    ok = false;
+                }
+                test_free(s);
+                continue;
+            }
+            to->size++;
+
+            element_t *last =
+                at_list_end(to->q, POS_TAIL)
+                    ? list_last_entry(to->q, element_t, list)
+                    : list_first_entry(to->q, element_t, list);
+            if (last->value != s) {
+                report(1, "ERROR: String was copied instead of adopted");
+                ok = false;
+            }
+            ok = ok && !error_check();
+        }
+    }
+    exception_cancel();
+
+    q_show(3);
+    return ok && !error_check();
+}
+
+static void set_order(int oldval)
+{
+    if (order < 0 || order >= N_ORDERS) {
+        report(1, "Invalid order %d (0-%d)", order, N_ORDERS - 1);
+        order = oldval;
+    }
+}
+
+static void set_memprof(int oldval)
+{
+    set_alloc_profiling(memprof);
+}
+
+static void set_sortalgo(int oldval)
+{
+    if (sortalgo < 0 || sortalgo >= N_SORTALGOS) {
+        report(1, "Invalid sorting engine %d (0-%d)", sortalgo,
+               N_SORTALGOS - 1);
+        sortalgo = oldval;
+    }
+}
+
+static void set_mergealgo(int oldval)
+{
+    if (mergealgo < 0 || mergealgo >= N_MERGEALGOS) {
+        report(1, "Invalid merging strategy %d (0-%d)", mergealgo,
+               N_MERGEALGOS - 1);
+        mergealgo = oldval;
+    }
+}
+
 static void console_init()
 {
     ADD_COMMAND(new, "Create new queue", "");
     ADD_COMMAND(free, "Delete queue", "");
     ADD_COMMAND(prev, "Switch to previous queue", "");
     ADD_COMMAND(next, "Switch to next queue", "");
+    ADD_COMMAND(move,
+                "Move n strings from head of queue to tail of next queue "
+                "without copying (default: n == 1)",
+                "[n]");
     ADD_COMMAND(ih,
                 "Insert string str at head of queue n times. Generate random "
                 "string(s) if str equals RAND. (default: n == 1)",
@@ -1118,41 +1942,102 @@ static void console_init()
                 "Insert string str at tail of queue n times. Generate random "
                 "string(s) if str equals RAND. (default: n == 1)",
                 "str [n]");
-    ADD_COMMAND(
-        rh,
-        "Remove from head of queue. Optionally compare to expected value str",
-        "[str]");
-    ADD_COMMAND(
-        rt,
-        "Remove from tail of queue. Optionally compare to expected value str",
-        "[str]");
+    ADD_COMMAND(rh,
+                "Remove from head of queue n times. Optionally compare to "
+                "expected value str (default: n == 1)",
+                "[str [n]]");
+    ADD_COMMAND(rt,
+                "Remove from tail of queue n times. Optionally compare to "
+                "expected value str (default: n == 1)",
+                "[str [n]]");
     ADD_COMMAND(reverse, "Reverse queue", "");
     ADD_COMMAND(sort, "Sort queue in ascending/descending order", "");
     ADD_COMMAND(size, "Compute queue size n times (default: n == 1)", "[n]");
     ADD_COMMAND(show, "Show queue contents", "");
     ADD_COMMAND(dm, "Delete middle node in queue", "");
-    ADD_COMMAND(dedup, "Delete all nodes that have duplicate string", "");
+    ADD_COMMAND(get,
+                "Get element at position k, n times. Position drawn at "
+                "random if k equals RAND. (default: n == 1)",
+                "k [n]");
+    ADD_COMMAND(delat,
+                "Delete element at position k, n times. Position drawn at "
+                "random if k equals RAND. (default: n == 1)",
+                "k [n]");
+    ADD_COMMAND(insat,
+                "Insert string str at position k, n times. Position drawn "
+                "at random if k equals RAND, random string(s) if str equals "
+                "RAND. (default: n == 1)",
+                "k str [n]");
+    ADD_COMMAND(dedup,
+                "Delete all nodes that have duplicate string, also unsorted "
+                "ones with -h",
+                "[-h]");
     ADD_COMMAND(merge, "Merge all the queues into one sorted queue", "");
     ADD_COMMAND(swap, "Swap every two adjacent nodes in queue", "");
     ADD_COMMAND(ascend,
                 "Remove every node which has a node with a strictly less "
-                "value anywhere to the right side of it",
-                "");
+                "value anywhere to the right side of it, collecting them "
+                "first with -c",
+                "[-c]");
     ADD_COMMAND(descend,
                 "Remove every node which has a node with a strictly greater "
-                "value anywhere to the right side of it",
-                "");
-    ADD_COMMAND(reverseK, "Reverse the nodes of the queue 'K' at a time",
-                "[K]");
+                "value anywhere to the right side of it, collecting them "
+                "first with -c",
+                "[-c]");
+    ADD_COMMAND(reverseK,
+                "Reverse the nodes of the queue 'K' at a time, once for each "
+                "K given",
+                "K [K ...]");
     ADD_COMMAND(shuffle, "Shuffle elements in queue", "str [n]");
+    ADD_COMMAND(compact,
+                "Move elements of queue and their strings to fresh memory in "
+                "queue order",
+                "");
+    ADD_COMMAND(cachestat,
+                "Show how often allocations reuse freed blocks, resetting the "
+                "counts with -r",
+                "[-r]");
+    ADD_COMMAND(memstat,
+                "Show the allocation profiles of the call sites allocating the "
+                "most bytes, forgetting all profiles with -r",
+                "[-r]");
     add_param("length", &string_length, "Maximum length of displayed string",
               NULL);
     add_param("malloc", &fail_probability, "Malloc failure probability percent",
               NULL);
+    add_param("timeout", &time_limit,
+              "Time limit in seconds for each queue operation (0: none)", NULL);
     add_param("fail", &fail_limit,
               "Number of times allow queue operations to return false", NULL);
     add_param("descend", &descend,
               "Sort and merge queue in ascending/descending order", NULL);
+    add_param("order", &order,
+              "Sort and merge order: 0 lexicographic, 1 numeric, "
+              "2 case-insensitive, 3 length-first",
+              set_order);
+    add_param("sortalgo", &sortalgo,
+              "Sorting engine on one thread: 0 merge sort, 1 radix sort",
+              set_sortalgo);
+    add_param("mergealgo", &mergealgo,
+              "Merging strategy: 0 k-way heap, 1 pairwise rounds",
+              set_mergealgo);
+    add_param("sortthreads", &sort_threads,
+              "Number of threads merge sorting queues of at least "
+              "'sortparsize' elements",
+              NULL);
+    add_param("sortparsize", &sort_par_size,
+              "Minimum queue size for sorting on multiple threads", NULL);
+    add_param("lazyreverse", &lazy_reverse,
+              "Reverse queues in constant time with a direction flag", NULL);
+    add_param("index", &use_index,
+              "Index queues for positional commands with a skip list", NULL);
+    add_param("bulk", &bulk_insert,
+              "Insert the n strings of 'ih' and 'it' in batches with the bulk "
+              "APIs",
+              NULL);
+    add_param("memprof", &memprof,
+              "Profile allocations by call site, shown with 'memstat'",
+              set_memprof);
 }
 
 /* Signal handlers */
@@ -1185,8 +2070,6 @@ static void q_init()
 static bool q_quit(int argc, char *argv[])
 {
     report(3, "Freeing queue");
-    if (current && current->size > BIG_LIST_SIZE)
-        set_cautious_mode(false);
 
     if (exception_setup(true)) {
         struct list_head *cur = chain.head.next;
@@ -1200,7 +2083,6 @@ static bool q_quit(int argc, char *argv[])
     }
 
     exception_cancel();
-    set_cautious_mode(true);
 
     size_t bcnt = allocation_check();
     if (bcnt > 0) {
@@ -1219,6 +2101,7 @@ static void usage(char *cmd)
     printf("\t-f FILE   Read commands from FILE\n");
     printf("\t-v LEVEL  Set verbosity level\n");
     printf("\t-l LOG    Echo results to LOG\n");
+    printf("\t-m FILE   Profile allocations and write the profiles to FILE\n");
     exit(0);
 }
 
@@ -1425,10 +2308,12 @@ int main(int argc, char *argv[])
     char *infile_name = NULL;
     char lbuf[BUFSIZE];
     char *logfile_name = NULL;
+    char mbuf[BUFSIZE];
+    char *memprof_name = NULL;
     int level = 4;
     int c;
 
-    while ((c = getopt(argc, argv, "hv:f:l:")) != -1) {
+    while ((c = getopt(argc, argv, "hv:f:l:m:")) != -1) {
         switch (c) {
         case 'h':
             usage(argv[0]);
@@ -1453,6 +2338,13 @@ int main(int argc, char *argv[])
             buf[BUFSIZE - 1] = '\0';
             logfile_name = lbuf;
             break;
+        case 'm':
+            strncpy(mbuf, optarg, BUFSIZE);
+            mbuf[BUFSIZE - 1] = '\0';
+            memprof_name = mbuf;
+            memprof = 1;
+            set_alloc_profiling(true);
+            break;
         default:
             printf("Unknown option '%c'\n", c);
             usage(argv[0]);
@@ -1492,5 +2384,9 @@ int main(int argc, char *argv[])
     /* Do finish_cmd() before check whether ok is true or false */
     ok = finish_cmd() && ok;
 
+    /* Written last, so that the queues freed on quit count as freed */
+    if (memprof_name)
+        ok = write_alloc_profile(memprof_name) && ok;
+
     return !ok;
 }
@@ -1,8 +1,14 @@
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h> /* strcasecmp */
 
+#include "list_ext.h"
 #include "queue.h"
+#include "queue_ext.h"
 
 /* Notice: sometimes, Cppcheck would find the potential NULL pointer bugs,
  * but some of them cannot occur. You can suppress them by adding the
@@ -10,20 +16,433 @@
  *   cppcheck-suppress nullPointer
  */
 
-static struct list_head *merge_sort(struct list_head *head, bool descend);
-static struct list_head *merge(struct list_head *l1,
-                               struct list_head *l2,
-                               bool descend);
+/* Queue head handed out by q_new(). The list node must stay the first member
+ * since qtest and dudect only see the embedded list_head and walk it as an
+ * ordinary circular list. @size is kept exact by every operation that links
+ * or unlinks elements, which makes q_size() constant time.
+ *
+ * @reversed is set by q_reverse_lazy(): the queue then runs from head->prev
+ * to head->next. Operations at either end honor it directly; those that walk
+ * the queue in order undo it with materialize() first.
+ *
+ * @index is the optional positional index, NULL unless q_index_enable() was
+ * called. Positions in it are those of the list, regardless of @reversed.
+ */
+typedef struct {
+    struct list_head head;
+    int size;
+    bool reversed;
+    struct q_index *index;
+} queue_t;
+
+static inline queue_t *queue_of(struct list_head *head)
+{
+    return container_of(head, queue_t, head);
+}
+
+/* Optional positional index enabled by q_index_enable(): a skip list whose
+ * bottom level is the queue's own list. Only the nodes promoted to level 1
+ * or above get a tower, so about a quarter of them carry one. Each link
+ * records its span, the number of list steps it skips, which turns a search
+ * by position into O(log n) hops and a short walk along the list.
+ */
+#define SKIP_MAX_LEVEL 16
+
+typedef struct skip_tower skip_tower_t;
+
+typedef struct {
+    skip_tower_t *next;
+    int span; /* Positions from this tower's node to @next's, if any */
+} skip_link_t;
+
+struct skip_tower {
+    struct list_head *node; /* Node standing at level 0, the list head for
+                             * the head tower */
+    skip_link_t lv[];       /* lv[i] links level i + 1 */
+};
+
+typedef struct q_index {
+    skip_tower_t *head; /* Tower of the list head, at position -1 */
+    int level;          /* Levels in use above the list */
+    bool stale;         /* Links no longer match the list; rebuild first */
+    uint64_t rng;
+} q_index_t;
+
+/* Draw the number of levels above the list for a new node: each one is
+ * reached with probability 1/4.
+ */
+static int index_height(q_index_t *ix)
+{
+    uint64_t r = ix->rng;
+    r ^= r << 13;
+    r ^= r >> 7;
+    r ^= r << 17;
+    ix->rng = r;
+
+    int h = 0;
+    while (h < SKIP_MAX_LEVEL && !(r & 3)) {
+        h++;
+        r >>= 2;
+    }
+    return h;
+}
+
+static skip_tower_t *tower_new(struct list_head *node, int height)
+{
+    skip_tower_t *t =
+        malloc(sizeof(skip_tower_t) + sizeof(skip_link_t) * height);
+    if (!t)
+        return NULL;
+    t->node = node;
+    return t;
+}
+
+/* Free every tower but the head's and unlink the head from all levels */
+static void index_clear(q_index_t *ix)
+{
+    skip_tower_t *t = ix->level ? ix->head->lv[0].next : NULL;
+    while (t) {
+        skip_tower_t *next = t->lv[0].next;
+        free(t);
+        t = next;
+    }
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++) {
+        ix->head->lv[i].next = NULL;
+        ix->head->lv[i].span = 0;
+    }
+    ix->level = 0;
+}
+
+/* Rebuild the towers over the list of @q in a single walk. A tower that
+ * cannot be allocated is left out, which only makes searches longer.
+ */
+static void index_build(queue_t *q)
+{
+    q_index_t *ix = q->index;
+    skip_tower_t *last[SKIP_MAX_LEVEL];
+    int last_pos[SKIP_MAX_LEVEL];
+
+    index_clear(ix);
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++) {
+        last[i] = ix->head;
+        last_pos[i] = -1;
+    }
+
+    int pos = 0;
+    struct list_head *node;
+    list_for_each (node, &q->head) {
+        int h = index_height(ix);
+        skip_tower_t *t = h ? tower_new(node, h) : NULL;
+        for (int i = 0; t && i < h; i++) {
+            last[i]->lv[i].next = t;
+            last[i]->lv[i].span = pos - last_pos[i];
+            t->lv[i].next = NULL;
+            t->lv[i].span = 0;
+            last[i] = t;
+            last_pos[i] = pos;
+        }
+        if (t && h > ix->level)
+            ix->level = h;
+        pos++;
+    }
+    ix->stale = false;
+}
+
+/* Find, on every level in use, the last tower at a position not above
+ * @target, storing it in @update and its position in @rank.
+ */
+static void index_find(q_index_t *ix,
+                       int target,
+                       skip_tower_t **update,
+                       int *rank)
+{
+    skip_tower_t *x = ix->head;
+    int pos = -1;
+
+    for (int i = ix->level - 1; i >= 0; i--) {
+        while (x->lv[i].next && pos + x->lv[i].span <= target) {
+            pos += x->lv[i].span;
+            x = x->lv[i].next;
+        }
+        update[i] = x;
+        rank[i] = pos;
+    }
+}
+
+/* Node at position @target, walking the list from the closest tower */
+static struct list_head *index_get(q_index_t *ix, int target)
+{
+    skip_tower_t *update[SKIP_MAX_LEVEL];
+    int rank[SKIP_MAX_LEVEL];
+    struct list_head *node = ix->head->node;
+    int pos = -1;
+
+    if (ix->level) {
+        index_find(ix, target, update, rank);
+        node = update[0]->node;
+        pos = rank[0];
+    }
+    for (; pos < target; pos++)
+        node = node->next;
+    return node;
+}
+
+/* Link @new into queue @q so that it ends up at list position @target */
+static void index_insert(queue_t *q, int target, struct list_head *new)
+{
+    q_index_t *ix = q->index;
+    skip_tower_t *update[SKIP_MAX_LEVEL];
+    int rank[SKIP_MAX_LEVEL];
+    struct list_head *prev = &q->head;
+    int pos = -1;
+
+    if (ix->level) {
+        index_find(ix, target - 1, update, rank);
+        prev = update[0]->node;
+        pos = rank[0];
+    }
+    for (; pos < target - 1; pos++)
+        prev = prev->next;
+    list_add(new, prev);
+
+    int h = index_height(ix);
+    skip_tower_t *t = h ? tower_new(new, h) : NULL;
+    if (!t)
+        h = 0;
+    for (int i = ix->level; i < h; i++) {
+        update[i] = ix->head;
+        rank[i] = -1;
+        ix->head->lv[i].next = NULL;
+    }
+    if (h > ix->level)
+        ix->level = h;
+
+    for (int i = 0; i < ix->level; i++) {
+        skip_link_t *l = &update[i]->lv[i];
+        if (i < h) {
+            t->lv[i].next = l->next;
+            t->lv[i].span = l->next ? rank[i] + l->span + 1 - target : 0;
+            l->next = t;
+            l->span = target - rank[i];
+        } else if (l->next) {
+            l->span++;
+        }
+    }
+}
+
+/* Unlink the node at list position @target from queue @q and return it */
+static struct list_head *index_delete(queue_t *q, int target)
+{
+    q_index_t *ix = q->index;
+    skip_tower_t *update[SKIP_MAX_LEVEL];
+    int rank[SKIP_MAX_LEVEL];
+    struct list_head *node = &q->head;
+    int pos = -1;
+
+    if (ix->level) {
+        index_find(ix, target - 1, update, rank);
+        node = update[0]->node;
+        pos = rank[0];
+    }
+    for (; pos < target; pos++)
+        node = node->next;
+
+    skip_tower_t *t = NULL;
+    for (int i = 0; i < ix->level; i++) {
+        skip_link_t *l = &update[i]->lv[i];
+        if (l->next && l->next->node == node) {
+            t = l->next;
+            l->span = t->lv[i].next ? l->span + t->lv[i].span - 1 : 0;
+            l->next = t->lv[i].next;
+        } else if (l->next) {
+            l->span--;
+        }
+    }
+    free(t);
+    while (ix->level && !ix->head->lv[ix->level - 1].next)
+        ix->level--;
+
+    list_del(node);
+    return node;
+}
+
+/* Drop the index of @q along with all its towers */
+static void index_free(queue_t *q)
+{
+    if (!q->index)
+        return;
+    index_clear(q->index);
+    free(q->index->head);
+    free(q->index);
+    q->index = NULL;
+}
+
+/* Index of @head if it can be used as is, NULL if disabled or stale */
+static inline q_index_t *index_live(struct list_head *head)
+{
+    q_index_t *ix = queue_of(head)->index;
+    return ix && !ix->stale ? ix : NULL;
+}
+
+/* Note that the list of @head was reordered wholesale. The index is rebuilt
+ * on its next positional use; operations such as q_sort() run where nothing
+ * may be allocated or freed.
+ */
+static inline void index_stale(struct list_head *head)
+{
+    q_index_t *ix = queue_of(head)->index;
+    if (ix)
+        ix->stale = true;
+}
+
+
+/* Swap the links of every node, the head included, reversing the list */
+static void reverse_links(struct list_head *head)
+{
+    struct list_head *cur = head, *tmp;
+
+    do {
+        tmp = cur->next;
+        cur->next = cur->prev;
+        cur->prev = tmp;
+        cur = tmp;
+    } while (cur != head);
+}
+
+/* Apply a pending lazy reversal to the links */
+static void materialize(struct list_head *head)
+{
+    queue_t *q = queue_of(head);
+
+    if (q->reversed) {
+        reverse_links(head);
+        q->reversed = false;
+        index_stale(head);
+    }
+}
+
+/* Whether the queue's head end is the front of the underlying list */
+static inline bool at_front(struct list_head *head, bool at_head)
+{
+    return at_head != queue_of(head)->reversed;
+}
+
+/* Link @e in at the head or the tail end of the queue */
+static inline void element_link(struct list_head *head,
+                                element_t *e,
+                                bool at_head)
+{
+    queue_t *q = queue_of(head);
+
+    if (index_live(head))
+        index_insert(q, at_front(head, at_head) ? 0 : q->size, &e->list);
+    else if (at_front(head, at_head))
+        list_add(&e->list, head);
+    else
+        list_add_tail(&e->list, head);
+    q->size++;
+}
+
+/* Unlink and return the node at the head or the tail end of the queue */
+static inline struct list_head *element_unlink_end(struct list_head *head,
+                                                   bool at_head)
+{
+    queue_t *q = queue_of(head);
+    bool front = at_front(head, at_head);
+    struct list_head *node;
+
+    if (index_live(head)) {
+        node = index_delete(q, front ? 0 : q->size - 1);
+    } else {
+        node = front ? head->next : head->prev;
+        list_del(node);
+    }
+    q->size--;
+    return node;
+}
+
+/* Allocate an element holding a copy of @s. The string is allocated right
+ * after the element. When the harness carves fresh memory for both, rather
+ * than reuse freed blocks, they sit next to each other in the same slab chunk
+ * and reaching the value from the node rarely costs another cache miss.
+ *
+ * The two cannot share one allocation: q_release_element() in queue.h, used
+ * by qtest and dudect, frees the value and the element as separate blocks,
+ * and q_unwrap_element() and the adopt variants pass a string from one
+ * element to another, so each string must be a block of its own.
+ */
+static element_t *element_new(const char *s)
+{
+    size_t len = strlen(s) + 1;
+    element_t *e = malloc(sizeof(element_t));
+    if (!e)
+        return NULL;
+
+    e->value = malloc(len);
+    if (!e->value) {
+        free(e);
+        return NULL;
+    }
+    memcpy(e->value, s, len);
+    return e;
+}
+
+/* Compare the values of two elements like strcmp(). Most strings in a queue
+ * already differ in their leading byte, which settles the comparison without
+ * a call into the C library.
+ */
+static inline int element_cmp(const element_t *a, const element_t *b)
+{
+    const unsigned char *x = (const unsigned char *) a->value;
+    const unsigned char *y = (const unsigned char *) b->value;
+
+    if (*x != *y)
+        return *x - *y;
+    return strcmp(a->value, b->value);
+}
+
+/* Comparators for q_sort_cmp() and q_merge_cmp() */
+
+int q_cmp_lex(const char *a, const char *b)
+{
+    return strcmp(a, b);
+}
+
+int q_cmp_num(const char *a, const char *b)
+{
+    long long x = strtoll(a, NULL, 10), y = strtoll(b, NULL, 10);
+
+    if (x != y)
+        return x < y ? -1 : 1;
+    return strcmp(a, b);
+}
+
+int q_cmp_case(const char *a, const char *b)
+{
+    return strcasecmp(a, b);
+}
+
+int q_cmp_len(const char *a, const char *b)
+{
+    size_t la = strlen(a), lb = strlen(b);
+
+    if (la != lb)
+        return la < lb ? -1 : 1;
+    return strcmp(a, b);
+}
 
 /* Create an empty queue */
 struct list_head *q_new()
 {
-    struct list_head *head = malloc(sizeof(struct list_head));
-    if (!head) {
+    queue_t *q = malloc(sizeof(queue_t));
+    if (!q) {
         return NULL;
     }
-    INIT_LIST_HEAD(head);
-    return head;
+    INIT_LIST_HEAD(&q->head);
+    q->size = 0;
+    q->reversed = false;
+    q->index = NULL;
+    return &q->head;
 }
 
 /* Free all storage used by queue */
@@ -33,14 +452,20 @@ void q_free(struct list_head *head)
         return;
     }
 
-    struct list_head *current, *tmp;
-    list_for_each_safe (current, tmp, head) {
+    /* Freeing a string reads its block header: the string of the element at
+     * the prefetch cursor starts loading while this one is freed
+     */
+    struct list_head *current, *tmp, *ahead;
+    list_for_each_safe_prefetch (current, tmp, ahead, head) {
         element_t *node = list_entry(current, element_t, list);
+        if (ahead != head)
+            __builtin_prefetch(list_entry(ahead, element_t, list)->value);
         list_del(current);
         free(node->value);
         free(node);
     }
-    free(head);
+    index_free(queue_of(head));
+    free(queue_of(head));
 }
 
 /* Insert an element at head of queue */
@@ -50,17 +475,11 @@ bool q_insert_head(struct list_head *head, char *s)
         return false;
     }
 
-    element_t *new_node = malloc(sizeof(element_t));
+    element_t *new_node = element_new(s);
     if (!new_node) {
         return false;
     }
-
-    new_node->value = strdup(s);
-    if (!new_node->value) {
-        free(new_node);
-        return false;
-    }
-    list_add(&new_node->list, head);
+    element_link(head, new_node, true);
     return true;
 }
 
@@ -71,24 +490,26 @@ bool q_insert_tail(struct list_head *head, char *s)
         return false;
     }
 
-    element_t *new_node = malloc(sizeof(element_t));
+    element_t *new_node = element_new(s);
     if (!new_node) {
         return false;
     }
-    new_node->value = strdup(s);
-    if (!new_node->value) {
-        free(new_node);
-        return false;
-    }
-
-    if (list_empty(head)) {
-        INIT_LIST_HEAD(&new_node->list);
-    }
-
-    list_add_tail(&new_node->list, head);
+    element_link(head, new_node, false);
     return true;
 }
 
+/* Copy @value into @sp up to @bufsize bytes including the terminator. Unlike
+ * strncpy(), nothing is written past the terminator, so a short string costs
+ * a short copy however large the buffer is.
+ */
+static inline void copy_value(char *sp, const char *value, size_t bufsize)
+{
+    if (!sp || !bufsize)
+        return;
+    if (!memccpy(sp, value, '\0', bufsize - 1))
+        sp[bufsize - 1] = '\0';
+}
+
 /* Remove an element from head of queue */
 element_t *q_remove_head(struct list_head *head, char *sp, size_t bufsize)
 {
@@ -96,15 +517,10 @@ element_t *q_remove_head(struct list_head *head, char *sp, size_t bufsize)
         return NULL;
     }
 
-    struct list_head *first = head->next;
-    element_t *node = list_entry(first, element_t, list);
+    element_t *node =
+        list_entry(element_unlink_end(head, true), element_t, list);
 
-    list_del(first);
-
-    if (sp) {
-        strncpy(sp, node->value, bufsize - 1);
-        sp[bufsize - 1] = '\0';
-    }
+    copy_value(sp, node->value, bufsize);
 
     return node;
 }
@@ -116,17 +532,173 @@ element_t *q_remove_tail(struct list_head *head, char *sp, size_t bufsize)
         return NULL;
     }
 
-    struct list_head *last = head->prev;
-    element_t *node = list_entry(last, element_t, list);
+    element_t *node =
+        list_entry(element_unlink_end(head, false), element_t, list);
 
-    list_del(last);
+    copy_value(sp, node->value, bufsize);
 
-    if (sp) {
-        strncpy(sp, node->value, bufsize - 1);
-        sp[bufsize - 1] = '\0';
+    return node;
+}
+
+/* Build a chain of elements holding copies of @strs in @chain, each added at
+ * the front when @at_head so that the chain reads like @n calls of
+ * q_insert_head(). Stops at the first allocation failure.
+ */
+static int chain_new(struct list_head *chain, char **strs, int n, bool at_head)
+{
+    int i;
+
+    INIT_LIST_HEAD(chain);
+    for (i = 0; i < n; i++) {
+        element_t *e = strs[i] ? element_new(strs[i]) : NULL;
+        if (!e)
+            break;
+        if (at_head)
+            list_add(&e->list, chain);
+        else
+            list_add_tail(&e->list, chain);
     }
+    return i;
+}
 
-    return node;
+static int insert_bulk(struct list_head *head, char **strs, int n, bool at_head)
+{
+    if (!head || !strs || n <= 0)
+        return 0;
+
+    bool front = at_front(head, at_head);
+    LIST_HEAD(chain);
+    int count = chain_new(&chain, strs, n, front);
+    index_stale(head);
+    if (front)
+        list_splice(&chain, head);
+    else
+        list_splice_tail(&chain, head);
+    queue_of(head)->size += count;
+    return count;
+}
+
+int q_insert_head_bulk(struct list_head *head, char **strs, int n)
+{
+    return insert_bulk(head, strs, n, true);
+}
+
+int q_insert_tail_bulk(struct list_head *head, char **strs, int n)
+{
+    return insert_bulk(head, strs, n, false);
+}
+
+static int remove_bulk(struct list_head *head,
+                       struct list_head *list,
+                       int n,
+                       bool at_head)
+{
+    if (!head || !list || n <= 0 || list_empty(head))
+        return 0;
+
+    queue_t *q = queue_of(head);
+    LIST_HEAD(cut);
+    index_stale(head);
+    if (n >= q->size) {
+        n = q->size;
+        list_splice_init(head, &cut);
+    } else if (at_front(head, at_head)) {
+        struct list_head *last = head;
+        for (int i = 0; i < n; i++)
+            last = last->next;
+        list_cut_position(&cut, head, last);
+    } else {
+        /* Cut the first size - n nodes off and keep them as the queue */
+        struct list_head *last = head;
+        for (int i = n; i > 0; i--)
+            last = last->prev;
+        last = last->prev;
+
+        LIST_HEAD(keep);
+        list_cut_position(&keep, head, last);
+        list_splice_init(head, &cut);
+        list_splice(&keep, head);
+    }
+
+    /* Hand the elements out in queue order */
+    if (q->reversed)
+        reverse_links(&cut);
+    list_splice_tail(&cut, list);
+    q->size -= n;
+    return n;
+}
+
+int q_remove_head_bulk(struct list_head *head, struct list_head *list, int n)
+{
+    return remove_bulk(head, list, n, true);
+}
+
+int q_remove_tail_bulk(struct list_head *head, struct list_head *list, int n)
+{
+    return remove_bulk(head, list, n, false);
+}
+
+/* Link a new element around @s, which the queue takes over */
+static bool element_adopt(struct list_head *head, char *s, bool at_head)
+{
+    if (!head || !s)
+        return false;
+
+    element_t *e = malloc(sizeof(element_t));
+    if (!e)
+        return false;
+
+    e->value = s;
+    element_link(head, e, at_head);
+    return true;
+}
+
+bool q_insert_head_adopt(struct list_head *head, char *s)
+{
+    return element_adopt(head, s, true);
+}
+
+bool q_insert_tail_adopt(struct list_head *head, char *s)
+{
+    return element_adopt(head, s, false);
+}
+
+char *q_unwrap_element(element_t *e)
+{
+    if (!e)
+        return NULL;
+
+    char *s = e->value;
+    free(e);
+    return s;
+}
+
+bool q_compact(struct list_head *head)
+{
+    if (!head)
+        return false;
+
+    materialize(head);
+    index_stale(head);
+
+    /* Each copy is allocated before its original is freed, so the queue is
+     * whole at every step and a failed allocation leaves it usable
+     */
+    bool ok = true;
+    struct list_head *cur, *next;
+    list_for_each_safe (cur, next, head) {
+        element_t *old = list_entry(cur, element_t, list);
+        element_t *e = element_new(old->value);
+        if (!e) {
+            ok = false;
+            break;
+        }
+        list_add(&e->list, cur);
+        list_del(cur);
+        free(old->value);
+        free(old);
+    }
+    return ok;
 }
 
 /* Return number of elements in queue */
@@ -135,12 +707,42 @@ int q_size(struct list_head *head)
     if (!head)
         return 0;
 
-    int len = 0;
-    struct list_head *li;
+    return queue_of(head)->size;
+}
+
+/* Node at list position @pos, walking from the nearer end of the list; the
+ * list head for @pos equal to the size.
+ */
+static struct list_head *walk_to(struct list_head *head, int pos)
+{
+    int size = queue_of(head)->size;
+    struct list_head *node;
+
+    if (pos <= size - pos) {
+        node = head->next;
+        for (int i = 0; i < pos; i++)
+            node = node->next;
+    } else {
+        node = head;
+        for (int i = size; i > pos; i--)
+            node = node->prev;
+    }
+    return node;
+}
+
+/* Unlink and return the node at list position @pos */
+static struct list_head *unlink_at(struct list_head *head, int pos)
+{
+    struct list_head *node;
 
-    list_for_each (li, head)
-        len++;
-    return len;
+    if (index_live(head)) {
+        node = index_delete(queue_of(head), pos);
+    } else {
+        node = walk_to(head, pos);
+        list_del(node);
+    }
+    queue_of(head)->size--;
+    return node;
 }
 
 /* Delete the middle node in queue */
@@ -150,20 +752,112 @@ bool q_delete_mid(struct list_head *head)
         return false;
     }
 
-    struct list_head *slow = head->next;
-    struct list_head *fast = head->next;
+    /* The size is known, so go straight to the middle, through the index or
+     * from the nearer end, instead of chasing it with a fast pointer over the
+     * whole queue.
+     */
+    int size = queue_of(head)->size, mid = size / 2;
+    if (queue_of(head)->reversed)
+        mid = size - 1 - mid;
+
+    element_t *elem = list_entry(unlink_at(head, mid), element_t, list);
+    free(elem->value);
+    free(elem);
+    return true;
+}
+
+bool q_index_enable(struct list_head *head)
+{
+    if (!head)
+        return false;
+
+    queue_t *q = queue_of(head);
+    if (q->index)
+        return true;
 
-    while (fast != head && fast->next != head) {
-        slow = slow->next;
-        fast = fast->next->next;
+    q_index_t *ix = malloc(sizeof(q_index_t));
+    skip_tower_t *t = tower_new(head, SKIP_MAX_LEVEL);
+    if (!ix || !t) {
+        free(ix);
+        free(t);
+        return false;
     }
+    ix->head = t;
+    ix->level = 0;
+    ix->rng = (uintptr_t) q | 1;
+    q->index = ix;
+    index_clear(ix);
+    index_build(q);
+    return true;
+}
 
-    element_t *node = list_entry(slow, element_t, list);
+void q_index_disable(struct list_head *head)
+{
+    if (head)
+        index_free(queue_of(head));
+}
 
-    list_del(&node->list);
+void q_index_invalidate(struct list_head *head)
+{
+    if (head)
+        index_stale(head);
+}
+
+/* Make the index of @head usable again after the list was reordered */
+static void index_refresh(struct list_head *head)
+{
+    q_index_t *ix = queue_of(head)->index;
+    if (ix && ix->stale)
+        index_build(queue_of(head));
+}
+
+element_t *q_get(struct list_head *head, int k)
+{
+    if (!head || k < 0 || k >= queue_of(head)->size)
+        return NULL;
+
+    queue_t *q = queue_of(head);
+    int pos = q->reversed ? q->size - 1 - k : k;
 
-    free(node->value);
-    free(node);
+    index_refresh(head);
+    struct list_head *node =
+        q->index ? index_get(q->index, pos) : walk_to(head, pos);
+    return list_entry(node, element_t, list);
+}
+
+bool q_delete_at(struct list_head *head, int k)
+{
+    if (!head || k < 0 || k >= queue_of(head)->size)
+        return false;
+
+    queue_t *q = queue_of(head);
+    int pos = q->reversed ? q->size - 1 - k : k;
+
+    index_refresh(head);
+    element_t *elem = list_entry(unlink_at(head, pos), element_t, list);
+    free(elem->value);
+    free(elem);
+    return true;
+}
+
+bool q_insert_at(struct list_head *head, int k, char *s)
+{
+    if (!head || !s || k < 0 || k > queue_of(head)->size)
+        return false;
+
+    queue_t *q = queue_of(head);
+    int pos = q->reversed ? q->size - k : k;
+
+    element_t *e = element_new(s);
+    if (!e)
+        return false;
+
+    index_refresh(head);
+    if (q->index)
+        index_insert(q, pos, &e->list);
+    else
+        list_add_tail(&e->list, walk_to(head, pos));
+    q->size++;
     return true;
 }
 
@@ -173,28 +867,34 @@ bool q_delete_dup(struct list_head *head)
     if (!head || list_empty(head))
         return false;
 
-    struct list_head *cur, *next;
+    struct list_head *cur, *next, *ahead;
     bool deleted = false;
 
-    list_for_each_safe (cur, next, head) {
+    /* Strings are compared as the walk reaches them, so the one at the
+     * prefetch cursor starts loading ahead of time
+     */
+    index_stale(head);
+    list_for_each_safe_prefetch (cur, next, ahead, head) {
         element_t *node = list_entry(cur, element_t, list);
+        if (ahead != head)
+            __builtin_prefetch(list_entry(ahead, element_t, list)->value);
 
         if (next != head) {
             const element_t *next_node = list_entry(next, element_t, list);
 
-            if (strcmp(node->value, next_node->value) == 0) {
+            if (element_cmp(node, next_node) == 0) {
                 deleted = true;
-                const char *dup_value = node->value;
                 struct list_head *tmp;
 
                 while (next != head &&
-                       strcmp(list_entry(next, element_t, list)->value,
-                              dup_value) == 0) {
+                       element_cmp(list_entry(next, element_t, list), node) ==
+                           0) {
                     tmp = next->next;
                     list_del(next);
                     element_t *del_node = list_entry(next, element_t, list);
                     free(del_node->value);
                     free(del_node);
+                    queue_of(head)->size--;
                     next = tmp;
                 }
 
@@ -202,13 +902,135 @@ bool q_delete_dup(struct list_head *head)
                 list_del(cur);
                 free(node->value);
                 free(node);
+                queue_of(head)->size--;
                 cur = tmp;
+                /* The cursor may have been on a deleted node */
+                ahead = list_prefetch_from(cur, head);
             }
         }
     }
     return deleted;
 }
 
+/* Hash of a string in the style of mulxror64 from tools/fmtscan.c: 64-bit
+ * chunks are multiplied into the hash and folded back with a rotation.
+ */
+static inline uint64_t hash_ror64(uint64_t x, unsigned int bits)
+{
+    return (x >> bits) | x << (64 - bits);
+}
+
+static uint64_t hash_mulxror64(const char *str, size_t len)
+{
+    uint64_t hash = len;
+
+    for (size_t i = len >> 3; i; i--) {
+        uint64_t v;
+
+        memcpy(&v, str, sizeof(v));
+        str += sizeof(v);
+        hash *= v | 1;
+        hash ^= hash_ror64(hash, 40);
+    }
+    for (size_t i = len & 7; i; i--) {
+        hash *= (uint8_t) *str++ | 0x100;
+        hash ^= hash_ror64(hash, 5);
+    }
+    return hash ^ (hash >> 32);
+}
+
+/* Slot of the open-addressing set used by q_delete_dup_hash(). @node is the
+ * first element seen with a value; @dup is set once another one turns up.
+ */
+typedef struct {
+    element_t *node;
+    uint32_t hash;
+    uint32_t dup;
+} dedup_slot_t;
+
+/* Home slot of hash @h in a set of 2^@bits slots. The low bits of
+ * hash_mulxror64() are poorly mixed, so the hash goes through Fibonacci
+ * hashing first and the slot is taken from the high bits of the product.
+ */
+static inline size_t dedup_home(uint64_t h, unsigned int bits)
+{
+    return (size_t) ((h * 0x9e3779b97f4a7c15ULL) >> (64 - bits));
+}
+
+bool q_delete_dup_hash(struct list_head *head)
+{
+    if (!head || list_empty(head))
+        return false;
+
+    unsigned int bits = 4;
+    while (((size_t) 1 << bits) < (size_t) queue_of(head)->size * 2)
+        bits++;
+    size_t cap = (size_t) 1 << bits;
+    dedup_slot_t *set = calloc(cap, sizeof(*set));
+    if (!set)
+        return false;
+    index_stale(head);
+
+    /* Probes land anywhere in the set: the slot of the element at the
+     * prefetch cursor starts loading while this one is handled. Its hash
+     * waits in @ring until the loop gets there, so that each string is
+     * hashed once; the ring starts with the hashes of the first elements.
+     */
+    uint64_t ring[LIST_PREFETCH_DISTANCE];
+    struct list_head *cur = head->next;
+    for (int k = 0; k < LIST_PREFETCH_DISTANCE && cur != head; k++) {
+        const char *v = list_entry(cur, element_t, list)->value;
+        ring[k] = hash_mulxror64(v, strlen(v));
+        __builtin_prefetch(&set[dedup_home(ring[k], bits)]);
+        cur = cur->next;
+    }
+
+    /* Later copies are deleted as they are found, the first one is kept in
+     * the set and marked so that it can be deleted afterwards.
+     */
+    struct list_head *next, *ahead;
+    size_t n = 0;
+    list_for_each_safe_prefetch (cur, next, ahead, head) {
+        element_t *node = list_entry(cur, element_t, list);
+        size_t r = n++ % LIST_PREFETCH_DISTANCE;
+        uint64_t h = ring[r];
+        size_t i = dedup_home(h, bits);
+
+        if (ahead != head) {
+            const char *v = list_entry(ahead, element_t, list)->value;
+            ring[r] = hash_mulxror64(v, strlen(v));
+            __builtin_prefetch(&set[dedup_home(ring[r], bits)]);
+        }
+
+        for (; set[i].node; i = (i + 1) & (cap - 1)) {
+            if (set[i].hash == (uint32_t) h &&
+                element_cmp(set[i].node, node) == 0)
+                break;
+        }
+        if (!set[i].node) {
+            set[i].node = node;
+            set[i].hash = (uint32_t) h;
+            continue;
+        }
+        set[i].dup = 1;
+        list_del(cur);
+        free(node->value);
+        free(node);
+        queue_of(head)->size--;
+    }
+
+    for (size_t i = 0; i < cap; i++) {
+        if (!set[i].dup)
+            continue;
+        list_del(&set[i].node->list);
+        free(set[i].node->value);
+        free(set[i].node);
+        queue_of(head)->size--;
+    }
+    free(set);
+    return true;
+}
+
 /* Swap every two adjacent nodes */
 void q_swap(struct list_head *head)
 {
@@ -216,15 +1038,23 @@ void q_swap(struct list_head *head)
         return;
     }
 
-    struct list_head *cur = head->next;
+    materialize(head);
+    index_stale(head);
+    struct list_head *prev = head, *first = head->next;
 
-    while (cur != head && cur->next != head) {
-        struct list_head *first = cur;
-        struct list_head *second = cur->next;
+    /* Relink each pair in place rather than deleting and re-adding a node */
+    while (first != head && first->next != head) {
+        struct list_head *second = first->next, *next = second->next;
 
-        list_move(first, second);
+        prev->next = second;
+        second->prev = prev;
+        second->next = first;
+        first->prev = second;
+        first->next = next;
+        next->prev = first;
 
-        cur = first->next;
+        prev = first;
+        first = next;
     }
     // https://leetcode.com/problems/swap-nodes-in-pairs/
 }
@@ -236,15 +1066,57 @@ void q_reverse(struct list_head *head)
         return;
     }
 
-    struct list_head *cur = head, *tmp;
+    reverse_links(head);
+    index_stale(head);
+}
 
-    do {
-        tmp = cur->next;
+void q_reverse_lazy(struct list_head *head)
+{
+    if (!head)
+        return;
+
+    queue_of(head)->reversed = !queue_of(head)->reversed;
+}
+
+bool q_is_reversed(struct list_head *head)
+{
+    return head && queue_of(head)->reversed;
+}
+
+void q_materialize(struct list_head *head)
+{
+    if (head)
+        materialize(head);
+}
+
+/* Reverse the @k nodes following @prev by swapping the links of each node in
+ * place, then reattach both ends. Return the last node of the reversed group,
+ * which precedes the next group.
+ */
+static struct list_head *reverse_group(struct list_head *prev, int k)
+{
+    struct list_head *first = prev->next, *cur = first;
+
+    for (int i = 0; i < k; i++) {
+        struct list_head *next = cur->next;
         cur->next = cur->prev;
-        cur->prev = tmp;
-        cur = tmp;
-    } while (cur != head);
-    return;
+        cur->prev = next;
+        cur = next;
+    }
+
+    struct list_head *last = cur->prev;
+    prev->next = last;
+    last->prev = prev;
+    first->next = cur;
+    cur->prev = first;
+    return first;
+}
+
+/* Reverse every full group of @k among the @count nodes following @prev */
+static void reverse_groups(struct list_head *prev, int count, int k)
+{
+    for (; count >= k; count -= k)
+        prev = reverse_group(prev, k);
 }
 
 /* Reverse the nodes of the list k at a time */
@@ -253,103 +1125,264 @@ void q_reverseK(struct list_head *head, int k)
     if (!head || list_empty(head) || k <= 1)
         return;
 
-    struct list_head *cur, *group_start, *next;
-    int count = 0;
+    materialize(head);
+    index_stale(head);
+    reverse_groups(head, queue_of(head)->size, k);
+}
 
-    list_for_each (cur, head)
-        count++;
+/* Largest block q_reverseK_many() permutes at once; longer periods fall back
+ * to one pass per k.
+ */
+#define REVERSEK_MAX_BLOCK 256
 
-    if (count < k)
-        return;
+static size_t gcd(size_t a, size_t b)
+{
+    while (b) {
+        size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
 
-    cur = head->next;
+void q_reverseK_many(struct list_head *head, const int *ks, int n)
+{
+    if (!head || list_empty(head) || !ks || n <= 0)
+        return;
 
-    while (count >= k) {
-        group_start = cur;
-        struct list_head *prev_tail = group_start->prev;
+    materialize(head);
+    index_stale(head);
+    /* Every group of every k lies within one block of lcm(ks) nodes, except
+     * in the tail after the last full block, so each block is permuted alike.
+     */
+    size_t block = 1;
+    for (int j = 0; j < n; j++) {
+        if (ks[j] <= 1)
+            continue;
+        block = block / gcd(block, ks[j]) * ks[j];
+        if (block > REVERSEK_MAX_BLOCK) {
+            for (j = 0; j < n; j++)
+                q_reverseK(head, ks[j]);
+            return;
+        }
+    }
+    if (block == 1)
+        return;
 
-        for (int i = 0; i < k; i++) {
-            next = cur->next;
-            list_move(cur, prev_tail);
-            cur = next;
+    unsigned char perm[REVERSEK_MAX_BLOCK];
+    for (size_t i = 0; i < block; i++)
+        perm[i] = i;
+    for (int j = 0; j < n; j++) {
+        if (ks[j] <= 1)
+            continue;
+        for (size_t g = 0; g < block; g += ks[j]) {
+            for (size_t l = g, r = g + ks[j] - 1; l < r; l++, r--) {
+                unsigned char t = perm[l];
+                perm[l] = perm[r];
+                perm[r] = t;
+            }
         }
+    }
 
-        group_start->next = cur;
-        if (cur)
-            cur->prev = group_start;
+    struct list_head *nodes[REVERSEK_MAX_BLOCK];
+    struct list_head *prev = head;
+    int count = queue_of(head)->size;
+    for (; count >= (int) block; count -= block) {
+        struct list_head *cur = prev->next;
+        for (size_t i = 0; i < block; i++) {
+            nodes[i] = cur;
+            cur = cur->next;
+        }
+        for (size_t i = 0; i < block; i++) {
+            prev->next = nodes[perm[i]];
+            nodes[perm[i]]->prev = prev;
+            prev = nodes[perm[i]];
+        }
+        prev->next = cur;
+        cur->prev = prev;
+    }
 
-        count -= k;
+    for (int j = 0; j < n; j++) {
+        if (ks[j] > 1)
+            reverse_groups(prev, count, ks[j]);
     }
 }
 
-/* Sort elements of queue in ascending/descending order */
-static struct list_head *merge(struct list_head *l1,
-                               struct list_head *l2,
-                               bool descend)
+/* Upper bound on pending runs in q_sort(). Run lengths on the stack grow at
+ * least as fast as the Fibonacci numbers, so 64 slots cover any queue whose
+ * size fits in an int.
+ */
+#define MAX_RUNS 64
+
+/* A sorted run of a NULL-terminated, singly-linked list */
+typedef struct {
+    struct list_head *list;
+    size_t len;
+} run_t;
+
+/* Order requested from q_sort_cmp() */
+typedef struct {
+    q_cmp_t cmp;
+    bool descend;
+} sort_order_t;
+
+/* Ordering of two nodes for q_sort(): negative if @a goes first */
+static inline int sort_cmp(const struct list_head *a,
+                           const struct list_head *b,
+                           const sort_order_t *ord)
 {
-    struct list_head dummy;
-    struct list_head *tail = &dummy;
+    const element_t *ea = list_entry(a, element_t, list);
+    const element_t *eb = list_entry(b, element_t, list);
 
-    while (l1 && l2) {
-        const element_t *e1 = list_entry(l1, element_t, list);
-        const element_t *e2 = list_entry(l2, element_t, list);
+    if (ord->descend) {
+        const element_t *tmp = ea;
+        ea = eb;
+        eb = tmp;
+    }
 
-        bool condition = descend ? (strcmp(e1->value, e2->value) < 0)
-                                 : (strcmp(e1->value, e2->value) > 0);
+    /* The default order gets the inlined comparison */
+    if (ord->cmp == q_cmp_lex)
+        return element_cmp(ea, eb);
+    return ord->cmp(ea->value, eb->value);
+}
 
-        if (!condition || strcmp(e1->value, e2->value) == 0) {
-            tail->next = l1;
-            l1 = l1->next;
+/* Merge two sorted, NULL-terminated lists linked through @next only. Ties are
+ * taken from @a, which precedes @b, to keep the sort stable.
+ */
+static struct list_head *merge(struct list_head *a,
+                               struct list_head *b,
+                               const sort_order_t *ord)
+{
+    struct list_head *head = NULL, **tail = &head;
+
+    for (;;) {
+        if (sort_cmp(a, b, ord) <= 0) {
+            *tail = a;
+            tail = &a->next;
+            a = a->next;
+            if (!a) {
+                *tail = b;
+                break;
+            }
         } else {
-            tail->next = l2;
-            l2 = l2->next;
+            *tail = b;
+            tail = &b->next;
+            b = b->next;
+            if (!b) {
+                *tail = a;
+                break;
+            }
         }
-
-        tail->next->prev = tail;
-        tail = tail->next;
     }
-
-    tail->next = l1 ? l1 : l2;
-    if (tail->next)
-        tail->next->prev = tail;
-
-    return dummy.next;
+    return head;
 }
-static struct list_head *merge_sort(struct list_head *head, bool descend)
+
+/* Detach the natural run at the start of @list into @run and return the rest
+ * of the list. A strictly descending run is reversed while it is scanned;
+ * equal neighbours end it, so reversing never reorders equal elements.
+ */
+static struct list_head *find_run(struct list_head *list,
+                                  run_t *run,
+                                  const sort_order_t *ord)
 {
-    if (!head || !head->next)
-        return head;
+    struct list_head *next = list->next;
 
-    struct list_head *slow = head, *fast = head->next;
-    while (fast && fast->next) {
-        slow = slow->next;
-        fast = fast->next->next;
+    run->len = 1;
+    if (!next) {
+        run->list = list;
+        return NULL;
     }
 
-    struct list_head *mid = slow->next;
-    slow->next = NULL;
+    if (sort_cmp(list, next, ord) > 0) {
+        struct list_head *rev = list;
+        rev->next = NULL;
+        do {
+            struct list_head *tmp = next->next;
+            next->next = rev;
+            rev = next;
+            next = tmp;
+            run->len++;
+        } while (next && sort_cmp(rev, next, ord) > 0);
+        run->list = rev;
+        return next;
+    }
 
-    struct list_head *left = merge_sort(head, descend);
-    struct list_head *right = merge_sort(mid, descend);
+    struct list_head *tail = next;
+    run->len = 2;
+    while (tail->next && sort_cmp(tail, tail->next, ord) <= 0) {
+        tail = tail->next;
+        run->len++;
+    }
+    next = tail->next;
+    tail->next = NULL;
+    run->list = list;
+    return next;
+}
 
-    return merge(left, right, descend);
+/* Merge the runs at @i and @i + 1 on the stack */
+static void merge_at(run_t *runs,
+                     size_t n,
+                     size_t i,
+                     const sort_order_t *ord)
+{
+    runs[i].list = merge(runs[i].list, runs[i + 1].list, ord);
+    runs[i].len += runs[i + 1].len;
+    if (i + 2 < n)
+        runs[i + 1] = runs[i + 2];
 }
 
-void q_sort(struct list_head *head, bool descend)
+/* Merge pending runs until their lengths satisfy the Timsort invariants
+ * (each run longer than the next one, and longer than the next two combined),
+ * which keeps the merges balanced and the stack logarithmic in depth.
+ */
+static size_t merge_collapse(run_t *runs, size_t n, const sort_order_t *ord)
 {
-    if (!head || list_empty(head) || head->next == head)
-        return;
+    while (n > 1) {
+        size_t i = n - 2;
+        if ((i > 0 && runs[i - 1].len <= runs[i].len + runs[i + 1].len) ||
+            (i > 1 && runs[i - 2].len <= runs[i - 1].len + runs[i].len)) {
+            if (runs[i - 1].len < runs[i + 1].len)
+                i--;
+        } else if (runs[i].len > runs[i + 1].len) {
+            break;
+        }
+        merge_at(runs, n--, i, ord);
+    }
+    return n;
+}
 
-    head->prev->next = NULL;
-    struct list_head *sorted = merge_sort(head->next, descend);
+/* Sort a NULL-terminated list linked through @next only
+ *
+ * Bottom-up natural merge sort: the list is consumed as a sequence of
+ * already-ordered runs, which are merged pairwise as in Timsort. Sorted and
+ * reverse-sorted input form a single run and are handled in linear time.
+ */
+static struct list_head *sort_list(struct list_head *list,
+                                   const sort_order_t *ord)
+{
+    run_t runs[MAX_RUNS];
+    size_t n = 0;
 
-    if (!sorted) {
-        head->next = head;
-        head->prev = head;
-        return;
+    while (list) {
+        list = find_run(list, &runs[n++], ord);
+        n = merge_collapse(runs, n, ord);
+    }
+
+    while (n > 1) {
+        size_t i = n - 2;
+        if (i > 0 && runs[i - 1].len < runs[i + 1].len)
+            i--;
+        merge_at(runs, n--, i, ord);
     }
+    return runs[0].list;
+}
 
-    struct list_head *cur = sorted, *prev = head;
+/* Restore the prev links of a queue whose nodes are chained through @next
+ * from @list, and close the circle.
+ */
+static void relink(struct list_head *head, struct list_head *list)
+{
+    struct list_head *cur = list, *prev = head;
     while (cur) {
         cur->prev = prev;
         prev->next = cur;
@@ -361,106 +1394,465 @@ void q_sort(struct list_head *head, bool descend)
     head->prev = prev;
 }
 
-/* Remove every node which has a node with a strictly less value anywhere to
- * the right side of it */
-int q_ascend(struct list_head *head)
+/* Sort elements of queue in ascending/descending order */
+void q_sort_cmp(struct list_head *head, q_cmp_t cmp, bool descend)
 {
-    if (!head || list_empty(head))
-        return 0;
+    if (!head || list_empty(head) || list_is_singular(head))
+        return;
 
-    struct list_head *cur = head->prev, *prev;
-    const element_t *min_elem = list_entry(cur, element_t, list);
-    int count = 1;
+    const sort_order_t ord = {.cmp = cmp, .descend = descend};
 
-    while (cur != head) {
-        prev = cur->prev;
-        element_t *e = list_entry(cur, element_t, list);
+    materialize(head);
+    index_stale(head);
+    head->prev->next = NULL;
+    relink(head, sort_list(head->next, &ord));
+}
 
-        if (strcmp(e->value, min_elem->value) > 0) {
-            list_del(cur);
-            free(e->value);
-            free(e);
-        } else {
-            min_elem = e;
-            count++;
+/* Buckets smaller than this are left to the merge sort */
+#define RADIX_CUTOFF 64
+
+/* Number of leading bytes distributed on before the merge sort takes over */
+#define RADIX_MAX_DEPTH 8
+
+/* Stable MSD radix sort of a NULL-terminated list on the byte at @depth.
+ * Nodes are appended to one of 256 buckets in list order, so equal keys keep
+ * their relative order. Bucket 0 holds strings that end at @depth; they are
+ * all equal and need no further sorting. The last node of the sorted list is
+ * stored in @tailp.
+ */
+static struct list_head *radix_sort(struct list_head *list,
+                                    size_t depth,
+                                    const sort_order_t *ord,
+                                    struct list_head **tailp)
+{
+    struct list_head *bucket[256];
+    struct list_head **tail[256];
+    size_t count[256] = {0};
+
+    for (int c = 0; c < 256; c++)
+        tail[c] = &bucket[c];
+
+    while (list) {
+        struct list_head *next = list->next;
+        unsigned char c = list_entry(list, element_t, list)->value[depth];
+        *tail[c] = list;
+        tail[c] = &list->next;
+        count[c]++;
+        list = next;
+    }
+
+    struct list_head *sorted = NULL, **sorted_tail = &sorted;
+    for (int i = 0; i < 256; i++) {
+        int c = ord->descend ? 255 - i : i;
+        if (!count[c])
+            continue;
+
+        *tail[c] = NULL;
+        struct list_head *first = bucket[c];
+        struct list_head *last = container_of(tail[c], struct list_head, next);
+        if (c && count[c] > 1) {
+            if (count[c] < RADIX_CUTOFF || depth + 1 >= RADIX_MAX_DEPTH) {
+                first = sort_list(first, ord);
+                for (last = first; last->next; last = last->next)
+                    ;
+            } else {
+                first = radix_sort(first, depth + 1, ord, &last);
+            }
         }
+        *sorted_tail = first;
+        sorted_tail = &last->next;
+    }
+
+    *tailp = container_of(sorted_tail, struct list_head, next);
+    return sorted;
+}
+
+/* Sort elements of queue in lexicographic order with a radix sort */
+void q_sort_radix(struct list_head *head, bool descend)
+{
+    if (!head || list_empty(head) || list_is_singular(head))
+        return;
+
+    const sort_order_t ord = {.cmp = q_cmp_lex, .descend = descend};
+    struct list_head *last;
+
+    materialize(head);
+    index_stale(head);
+    head->prev->next = NULL;
+    relink(head, radix_sort(head->next, 0, &ord, &last));
+}
+
+/* Most worker threads used by q_sort_parallel() */
+#define MAX_SORT_THREADS 64
+
+/* A unit of work for a q_sort_parallel() worker: sort @list, or merge it with
+ * @other when @other is set. The result is left in @list.
+ */
+typedef struct {
+    pthread_t thread;
+    bool started;
+    struct list_head *list, *other;
+    const sort_order_t *ord;
+} sort_job_t;
+
+static void *sort_worker(void *arg)
+{
+    sort_job_t *job = arg;
+
+    if (job->other)
+        job->list = merge(job->list, job->other, job->ord);
+    else
+        job->list = sort_list(job->list, job->ord);
+    return NULL;
+}
 
-        cur = prev;
+/* Run @jobs concurrently, doing the last one on the calling thread. A job
+ * whose thread cannot be created is done inline as well.
+ */
+static void run_sort_jobs(sort_job_t *jobs, int n)
+{
+    for (int i = 0; i < n - 1; i++)
+        jobs[i].started =
+            !pthread_create(&jobs[i].thread, NULL, sort_worker, &jobs[i]);
+    sort_worker(&jobs[n - 1]);
+
+    for (int i = 0; i < n - 1; i++) {
+        if (jobs[i].started)
+            pthread_join(jobs[i].thread, NULL);
+        else
+            sort_worker(&jobs[i]);
     }
+}
 
-    head->prev = min_elem->list.prev;
-    head->prev->next = head;
+/* Sort elements of queue with up to @nthreads threads
+ *
+ * The queue is cut into @nthreads contiguous segments which are sorted
+ * concurrently, then adjacent segments are merged pairwise, again
+ * concurrently, until one list is left. Merging only adjacent segments with
+ * ties taken from the left keeps the sort stable.
+ *
+ * Workers neither allocate nor free. All signals are blocked while workers
+ * run: they inherit the mask, and the SIGALRM time limit cannot longjmp out
+ * of the calling thread while workers still own the nodes. A pending alarm
+ * is delivered once the queue is whole again.
+ */
+void q_sort_parallel(struct list_head *head,
+                     q_cmp_t cmp,
+                     bool descend,
+                     int nthreads)
+{
+    int size = q_size(head);
+    if (nthreads > MAX_SORT_THREADS)
+        nthreads = MAX_SORT_THREADS;
+    if (nthreads < 2 || size < 2 * nthreads) {
+        q_sort_cmp(head, cmp, descend);
+        return;
+    }
 
-    return count;
+    const sort_order_t ord = {.cmp = cmp, .descend = descend};
+    sort_job_t jobs[MAX_SORT_THREADS];
+
+    /* Cut the list into segments of nearly equal length */
+    materialize(head);
+    index_stale(head);
+    head->prev->next = NULL;
+    struct list_head *cur = head->next;
+    for (int i = 0; i < nthreads; i++) {
+        int len = size / nthreads + (i < size % nthreads);
+        jobs[i] = (sort_job_t){.list = cur, .ord = &ord};
+        while (--len)
+            cur = cur->next;
+        struct list_head *next = cur->next;
+        cur->next = NULL;
+        cur = next;
+    }
+
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    run_sort_jobs(jobs, nthreads);
+
+    for (int n = nthreads; n > 1;) {
+        int pairs = n / 2;
+        for (int i = 0; i < pairs; i++)
+            jobs[i] = (sort_job_t){
+                .list = jobs[2 * i].list,
+                .other = jobs[2 * i + 1].list,
+                .ord = &ord,
+            };
+        run_sort_jobs(jobs, pairs);
+        if (n % 2)
+            jobs[pairs] = jobs[n - 1];
+        n = pairs + n % 2;
+    }
+
+    relink(head, jobs[0].list);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
 }
 
-/* Remove every node which has a node with a strictly greater value anywhere to
- * the right side of it */
-int q_descend(struct list_head *head)
+void q_sort(struct list_head *head, bool descend)
+{
+    q_sort_cmp(head, q_cmp_lex, descend);
+}
+
+/* Drop every node that has a strictly smaller (@descend: greater) value to its
+ * right, walking once from the tail while keeping the running minimum
+ * (maximum). Dropped nodes are moved onto @removed in queue order, or freed
+ * on the spot if @removed is NULL: the node and its string were just read
+ * by the comparison, while collecting them for a later pass would load them
+ * again, which traces/bench-ascend.cmd shows to be slower. Return the number
+ * of nodes left in the queue.
+ */
+static int filter_monotonic(struct list_head *head,
+                            struct list_head *removed,
+                            bool descend)
 {
     if (!head || list_empty(head))
         return 0;
 
-    struct list_head *cur = head->prev;
-    struct list_head *prev = cur->prev;
-    const element_t *max_elem = list_entry(cur, element_t, list);
+    materialize(head);
+    index_stale(head);
+    struct list_head *prev = head->prev->prev;
+    const element_t *bound = list_entry(head->prev, element_t, list);
     int count = 1;
 
     while (prev != head) {
         element_t *e = list_entry(prev, element_t, list);
         struct list_head *tmp = prev->prev;
+        int cmp = element_cmp(e, bound);
 
-        if (strcmp(e->value, max_elem->value) < 0) {
+        if (!(descend ? cmp < 0 : cmp > 0)) {
+            bound = e;
+            count++;
+        } else if (removed) {
+            list_move(prev, removed);
+        } else {
             list_del(prev);
             free(e->value);
             free(e);
-        } else {
-            max_elem = e;
-            count++;
         }
 
         prev = tmp;
     }
 
+    queue_of(head)->size = count;
     return count;
 }
 
-/* Merge all the queues into one sorted queue, which is in ascending/descending
- * order */
-int q_merge(struct list_head *head, bool descend)
+/* Remove every node which has a node with a strictly less value anywhere to
+ * the right side of it */
+int q_ascend(struct list_head *head)
+{
+    return filter_monotonic(head, NULL, false);
+}
+
+/* Remove every node which has a node with a strictly greater value anywhere to
+ * the right side of it */
+int q_descend(struct list_head *head)
+{
+    return filter_monotonic(head, NULL, true);
+}
+
+int q_ascend_collect(struct list_head *head, struct list_head *list)
+{
+    LIST_HEAD(removed);
+    int count = filter_monotonic(head, list ? &removed : NULL, false);
+    if (list)
+        list_splice_tail(&removed, list);
+    return count;
+}
+
+int q_descend_collect(struct list_head *head, struct list_head *list)
+{
+    LIST_HEAD(removed);
+    int count = filter_monotonic(head, list ? &removed : NULL, true);
+    if (list)
+        list_splice_tail(&removed, list);
+    return count;
+}
+
+/* Most queues merged at once by q_merge_cmp() and q_merge_pairwise(); longer
+ * chains are merged in batches, whose results are merged in turn as in a
+ * tournament.
+ */
+#define MAX_MERGE_WAYS 1024
+
+/* Batch results pending in merge_chain(). Each merges 2^rank batches, and
+ * ranks strictly decrease towards the top, so 64 levels cover any chain.
+ */
+typedef struct {
+    struct list_head *list;
+    int rank;
+} merge_batch_t;
+
+/* Push the result of the next batch onto the stack of @n pending ones,
+ * merging the top two while they have the same rank. Return the new count.
+ */
+static int merge_batch_push(merge_batch_t *stack,
+                            int n,
+                            struct list_head *list,
+                            const sort_order_t *ord)
+{
+    stack[n++] = (merge_batch_t){.list = list, .rank = 0};
+    while (n > 1 && stack[n - 2].rank == stack[n - 1].rank) {
+        /* The earlier batch goes first, for stability */
+        stack[n - 2].list = merge(stack[n - 2].list, stack[n - 1].list, ord);
+        stack[n - 2].rank++;
+        n--;
+    }
+    return n;
+}
+
+/* Source list of the k-way merge, with its position in the chain */
+typedef struct {
+    struct list_head *list;
+    int src;
+} merge_src_t;
+
+/* Heap order of two sources; ties go to the earlier queue for stability */
+static inline bool merge_src_less(const merge_src_t *a,
+                                  const merge_src_t *b,
+                                  const sort_order_t *ord)
+{
+    int cmp = sort_cmp(a->list, b->list, ord);
+    return cmp < 0 || (cmp == 0 && a->src < b->src);
+}
+
+static void merge_sift_down(merge_src_t *heap,
+                            int n,
+                            int i,
+                            const sort_order_t *ord)
+{
+    merge_src_t top = heap[i];
+
+    for (int child; (child = 2 * i + 1) < n; i = child) {
+        if (child + 1 < n &&
+            merge_src_less(&heap[child + 1], &heap[child], ord))
+            child++;
+        if (!merge_src_less(&heap[child], &top, ord))
+            break;
+        heap[i] = heap[child];
+    }
+    heap[i] = top;
+}
+
+/* Merge @k sorted, non-empty lists with a min-heap over their heads */
+static struct list_head *merge_heap(struct list_head **lists,
+                                    int k,
+                                    const sort_order_t *ord)
+{
+    merge_src_t heap[MAX_MERGE_WAYS];
+    int n = k;
+
+    for (int i = 0; i < k; i++)
+        heap[i] = (merge_src_t){.list = lists[i], .src = i};
+    for (int i = n / 2 - 1; i >= 0; i--)
+        merge_sift_down(heap, n, i, ord);
+
+    struct list_head *merged = NULL, **tail = &merged;
+    while (n > 1) {
+        struct list_head *node = heap[0].list;
+        *tail = node;
+        tail = &node->next;
+        if (node->next) {
+            heap[0].list = node->next;
+            /* The node after the new head is compared next in its list */
+            __builtin_prefetch(node->next->next);
+        } else {
+            heap[0] = heap[--n];
+        }
+        merge_sift_down(heap, n, 0, ord);
+    }
+    *tail = heap[0].list;
+    return merged;
+}
+
+/* Merge @k sorted, non-empty lists in rounds of adjacent pairs */
+static struct list_head *merge_pairwise(struct list_head **lists,
+                                        int k,
+                                        const sort_order_t *ord)
+{
+    for (int step = 1; step < k; step *= 2) {
+        for (int i = 0; i + step < k; i += 2 * step)
+            lists[i] = merge(lists[i], lists[i + step], ord);
+    }
+    return lists[0];
+}
+
+typedef struct list_head *(*merge_fn_t)(struct list_head **lists,
+                                        int k,
+                                        const sort_order_t *ord);
+
+/* Move the elements of every queue in the chain into the first one, merging
+ * the sorted queues with @merge_fn.
+ */
+static int merge_chain(struct list_head *head,
+                       const sort_order_t *ord,
+                       merge_fn_t merge_fn)
 {
     if (!head || list_empty(head) || list_is_singular(head))
         return 0;
 
-    struct list_head *cur, *next;
     queue_contex_t *main_ctx = list_entry(head->next, queue_contex_t, chain);
     if (!main_ctx->q)
         return 0;
 
-    int total_size = main_ctx->size;
+    struct list_head *lists[MAX_MERGE_WAYS];
+    merge_batch_t batches[64];
+    int k = 0, nb = 0, total = 0;
+    queue_contex_t *ctx;
 
-    list_for_each_safe (cur, next, head) {
-        queue_contex_t *ctx = list_entry(cur, queue_contex_t, chain);
-        if (ctx == main_ctx || !ctx->q || list_empty(ctx->q))
+    list_for_each_entry (ctx, head, chain) {
+        if (!ctx->q)
+            continue;
+        materialize(ctx->q);
+        index_stale(ctx->q);
+        if (list_empty(ctx->q))
             continue;
 
-        struct list_head *sub_queue = ctx->q;
-        while (!list_empty(sub_queue)) {
-            struct list_head *node = sub_queue->next;
-            list_del(node);
-            list_add_tail(node, main_ctx->q);
+        if (k == MAX_MERGE_WAYS) {
+            nb = merge_batch_push(batches, nb, merge_fn(lists, k, ord), ord);
+            k = 0;
         }
 
+        ctx->q->prev->next = NULL;
+        lists[k++] = ctx->q->next;
+        total += queue_of(ctx->q)->size;
         INIT_LIST_HEAD(ctx->q);
-        total_size += ctx->size;
+        queue_of(ctx->q)->size = 0;
         ctx->size = 0;
     }
 
-    main_ctx->q->prev->next = main_ctx->q;
-    main_ctx->q->next->prev = main_ctx->q;
+    if (k)
+        nb = merge_batch_push(batches, nb, merge_fn(lists, k, ord), ord);
+    if (nb) {
+        struct list_head *merged = batches[--nb].list;
+        while (nb)
+            merged = merge(batches[--nb].list, merged, ord);
+        relink(main_ctx->q, merged);
+    }
 
-    q_sort(main_ctx->q, descend);
+    queue_of(main_ctx->q)->size = total;
+    main_ctx->size = total;
+    return total;
+}
 
-    main_ctx->size = total_size;
-    return main_ctx->size;
-}
\ No newline at end of file
+/* Merge all the queues into one sorted queue, which is in ascending/descending
+ * order */
+int q_merge_cmp(struct list_head *head, q_cmp_t cmp, bool descend)
+{
+    const sort_order_t ord = {.cmp = cmp, .descend = descend};
+    return merge_chain(head, &ord, merge_heap);
+}
+
+int q_merge_pairwise(struct list_head *head, q_cmp_t cmp, bool descend)
+{
+    const sort_order_t ord = {.cmp = cmp, .descend = descend};
+    return merge_chain(head, &ord, merge_pairwise);
+}
+
+int q_merge(struct list_head *head, bool descend)
+{
+    return q_merge_cmp(head, q_cmp_lex, descend);
+}
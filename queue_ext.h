@@ -0,0 +1,360 @@
+#ifndef LAB0_QUEUE_EXT_H
+#define LAB0_QUEUE_EXT_H
+
+/* Extensions to the queue operations declared in queue.h.
+ *
+ * queue.h is the interface checked by the grader and must not change, so
+ * operations beyond it are declared here. They work on queues created by
+ * q_new() and keep the same conventions.
+ *
+ * The storage behind a queue cannot be switched to another layout, such as
+ * an unrolled list of blocks of string pointers: qtest and dudect walk the
+ * embedded list_head directly, q_remove_head() hands out element_t nodes and
+ * q_release_element() frees each node and its value as separate blocks.
+ * Locality comes from the harness instead, which carves small blocks out of
+ * 64 KiB slabs so that a node and its string are adjacent when both are
+ * carved fresh. Blocks freed earlier are reused first, though, so after much
+ * churn q_compact() is what brings them back together.
+ */
+
+#include <stdbool.h>
+
+#include "queue.h"
+
+/**
+ * q_cmp_t - Comparison function for ordering queue elements
+ * @a: value of the first element
+ * @b: value of the second element
+ *
+ * Return: negative, zero or positive as @a sorts before, equal to or after @b
+ */
+typedef int (*q_cmp_t)(const char *a, const char *b);
+
+/* Lexicographic order, as strcmp(); the order used by q_sort() and q_merge() */
+int q_cmp_lex(const char *a, const char *b);
+
+/* Numeric order of the leading integers, ties broken lexicographically */
+int q_cmp_num(const char *a, const char *b);
+
+/* Case-insensitive lexicographic order */
+int q_cmp_case(const char *a, const char *b);
+
+/* Shorter strings first, ties broken lexicographically */
+int q_cmp_len(const char *a, const char *b);
+
+/**
+ * q_insert_head_bulk() - Insert several elements at head of queue
+ * @head: header of queue
+ * @strs: strings to be copied and inserted, in the order of insertion
+ * @n: number of strings in @strs
+ *
+ * Same result as calling q_insert_head() on each string in turn. The new
+ * elements are linked into a private chain first, which is then spliced into
+ * the queue at once. Stops at the first string that cannot be allocated.
+ *
+ * Return: the number of strings inserted
+ */
+int q_insert_head_bulk(struct list_head *head, char **strs, int n);
+
+/**
+ * q_insert_tail_bulk() - Insert several elements at tail of queue
+ * @head: header of queue
+ * @strs: strings to be copied and inserted, in the order of insertion
+ * @n: number of strings in @strs
+ *
+ * Same result as calling q_insert_tail() on each string in turn, with the
+ * elements spliced into the queue at once as in q_insert_head_bulk().
+ *
+ * Return: the number of strings inserted
+ */
+int q_insert_tail_bulk(struct list_head *head, char **strs, int n);
+
+/**
+ * q_remove_head_bulk() - Remove up to @n elements from head of queue
+ * @head: header of queue
+ * @list: list the removed elements are appended to
+ * @n: maximum number of elements to remove
+ *
+ * The elements keep their queue order on @list. No strings are copied; as
+ * with q_remove_head(), the caller releases the elements.
+ *
+ * Return: the number of elements removed
+ */
+int q_remove_head_bulk(struct list_head *head, struct list_head *list, int n);
+
+/**
+ * q_remove_tail_bulk() - Remove up to @n elements from tail of queue
+ * @head: header of queue
+ * @list: list the removed elements are appended to
+ * @n: maximum number of elements to remove
+ *
+ * Like q_remove_head_bulk(), and the elements also keep their queue order,
+ * which is the reverse of the order q_remove_tail() would return them in.
+ *
+ * Return: the number of elements removed
+ */
+int q_remove_tail_bulk(struct list_head *head, struct list_head *list, int n);
+
+/**
+ * q_insert_head_adopt() - Insert an element at head of queue without copying
+ * its string
+ * @head: header of queue
+ * @s: string allocated with the harness malloc or strdup
+ *
+ * The queue takes ownership of @s, which is freed with its element. On
+ * failure @s stays with the caller.
+ *
+ * Return: true for success, false for allocation failed or queue is NULL
+ */
+bool q_insert_head_adopt(struct list_head *head, char *s);
+
+/**
+ * q_insert_tail_adopt() - Insert an element at tail of queue without copying
+ * its string
+ * @head: header of queue
+ * @s: string allocated with the harness malloc or strdup
+ *
+ * Same ownership rules as q_insert_head_adopt().
+ *
+ * Return: true for success, false for allocation failed or queue is NULL
+ */
+bool q_insert_tail_adopt(struct list_head *head, char *s);
+
+/**
+ * q_unwrap_element() - Release a removed element but keep its string
+ * @e: element removed from a queue
+ *
+ * q_remove_head() and q_remove_tail() copy nothing when @sp is NULL. Together
+ * with this and the adopt variants, a string moves from one queue to another
+ * without being copied.
+ *
+ * Return: the string of @e, now owned by the caller
+ */
+char *q_unwrap_element(element_t *e);
+
+/**
+ * q_compact() - Move the elements of queue to fresh memory in queue order
+ * @head: header of queue
+ *
+ * After many insertions and removals, the elements of a queue and their
+ * strings are spread over the heap, and a walk over the queue misses the
+ * cache at nearly every node. Each element and its string are reallocated
+ * here in queue order, and the originals are freed. When the allocator
+ * carves fresh memory rather than reuse freed blocks, as qtest has the
+ * harness do around this call, the copies lie one after the other. Elements
+ * obtained from the queue before are no longer valid afterwards.
+ *
+ * Return: true for success, false if queue is NULL or an allocation failed,
+ * in which case the queue is intact but only partly compacted
+ */
+bool q_compact(struct list_head *head);
+
+/**
+ * q_index_enable() - Attach a positional index to queue
+ * @head: header of queue
+ *
+ * The index is a skip list layered over the queue's list: about one element
+ * in four gets a tower of links that know how many positions they skip.
+ * q_get(), q_delete_at() and q_insert_at() then take O(log n) time, and so
+ * does q_delete_mid(). Insertion and removal at either end keep the index up
+ * to date at O(log n) cost each. Operations that reorder or thin out the
+ * whole queue, such as sorting or deduplication, leave it to be rebuilt in
+ * O(n) by the next positional operation.
+ *
+ * Return: true if the queue has an index, false if it could not be allocated
+ */
+bool q_index_enable(struct list_head *head);
+
+/**
+ * q_index_disable() - Drop the positional index of queue, if any
+ * @head: header of queue
+ */
+void q_index_disable(struct list_head *head);
+
+/**
+ * q_index_invalidate() - Have the positional index rebuilt before its next use
+ * @head: header of queue
+ *
+ * Needed after relinking the list outside of these functions.
+ */
+void q_index_invalidate(struct list_head *head);
+
+/**
+ * q_get() - Get the element at a position in queue
+ * @head: header of queue
+ * @k: position, 0 for the head
+ *
+ * Walks from the nearer end of the queue unless it has an index.
+ *
+ * Return: the element, still in queue, or NULL if @k is out of range
+ */
+element_t *q_get(struct list_head *head, int k);
+
+/**
+ * q_delete_at() - Delete the element at a position in queue
+ * @head: header of queue
+ * @k: position, 0 for the head
+ *
+ * Return: true for success, false if @k is out of range
+ */
+bool q_delete_at(struct list_head *head, int k);
+
+/**
+ * q_insert_at() - Insert an element at a position in queue
+ * @head: header of queue
+ * @k: position the new element takes, from 0 for the head to the size of
+ *     queue for the tail
+ * @s: string to be copied and inserted into the queue
+ *
+ * Return: true for success, false for allocation failed, @k out of range or
+ * queue is NULL
+ */
+bool q_insert_at(struct list_head *head, int k, char *s);
+
+/**
+ * q_delete_dup_hash() - Delete all nodes that have duplicate string, whether
+ * or not they are adjacent
+ * @head: header of queue
+ *
+ * Same result as q_delete_dup() on a sorted queue, but the queue may be in
+ * any order: a hash set over the values finds the duplicates in one pass,
+ * and the remaining elements keep their order.
+ *
+ * Return: true for success, false if list is NULL or empty or the set could
+ * not be allocated.
+ */
+bool q_delete_dup_hash(struct list_head *head);
+
+/**
+ * q_reverse_lazy() - Reverse elements in queue in constant time
+ * @head: header of queue
+ *
+ * Only flips a direction flag on the queue. Insertion and removal at either
+ * end, q_size(), q_delete_mid() and deduplication honor the flag as is;
+ * operations that walk the queue in order, such as sorting, swapping and
+ * merging, apply the reversal to the links first. Code walking the list
+ * itself must check q_is_reversed() or call q_materialize().
+ */
+void q_reverse_lazy(struct list_head *head);
+
+/**
+ * q_is_reversed() - Whether a lazy reversal of queue is pending
+ * @head: header of queue
+ *
+ * Return: true if the queue runs from head->prev back to head->next
+ */
+bool q_is_reversed(struct list_head *head);
+
+/**
+ * q_materialize() - Apply a pending lazy reversal to the links of queue
+ * @head: header of queue
+ */
+void q_materialize(struct list_head *head);
+
+/**
+ * q_reverseK_many() - Apply q_reverseK() for several values of k in turn
+ * @head: header of queue
+ * @ks: the values of k, applied in order
+ * @n: number of values in @ks
+ *
+ * Same result as calling q_reverseK() once per value, but done in a single
+ * traversal: the combined reordering repeats every lcm(ks) nodes, so each
+ * such block is relinked once. Falls back to one pass per value when the
+ * lcm exceeds 256.
+ */
+void q_reverseK_many(struct list_head *head, const int *ks, int n);
+
+/**
+ * q_sort_cmp() - Sort elements of queue with a given comparator
+ * @head: header of queue
+ * @cmp: comparator defining the ascending order
+ * @descend: whether or not to sort in descending order
+ *
+ * The sort is stable. q_sort() is q_sort_cmp() with q_cmp_lex.
+ */
+void q_sort_cmp(struct list_head *head, q_cmp_t cmp, bool descend);
+
+/**
+ * q_sort_radix() - Sort elements of queue in lexicographic order with an MSD
+ * radix sort
+ * @head: header of queue
+ * @descend: whether or not to sort in descending order
+ *
+ * Produces the same order as q_sort(), including the relative order of equal
+ * elements, by distributing nodes on the bytes of their strings. Nodes are
+ * relinked in place; strings are neither copied nor moved.
+ */
+void q_sort_radix(struct list_head *head, bool descend);
+
+/**
+ * q_sort_parallel() - Sort elements of queue on several threads
+ * @head: header of queue
+ * @cmp: comparator defining the ascending order
+ * @descend: whether or not to sort in descending order
+ * @nthreads: number of threads to sort with, including the caller
+ *
+ * Produces the same order as q_sort_cmp(), which is used directly when
+ * @nthreads is below 2 or the queue is too short to split.
+ */
+void q_sort_parallel(struct list_head *head,
+                     q_cmp_t cmp,
+                     bool descend,
+                     int nthreads);
+
+/**
+ * q_ascend_collect() - Remove every node which has a node with a strictly
+ * less value anywhere to the right side of it, without freeing them
+ * @head: header of queue
+ * @list: list the removed elements are appended to, in queue order
+ *
+ * Same as q_ascend(), which frees each removed element as soon as it is
+ * found. Here the caller releases them instead.
+ *
+ * Return: the number of elements in queue after performing operation
+ */
+int q_ascend_collect(struct list_head *head, struct list_head *list);
+
+/**
+ * q_descend_collect() - Remove every node which has a node with a strictly
+ * greater value anywhere to the right side of it, without freeing them
+ * @head: header of queue
+ * @list: list the removed elements are appended to, in queue order
+ *
+ * Same as q_descend(), with the removed elements handed to the caller as in
+ * q_ascend_collect().
+ *
+ * Return: the number of elements in queue after performing operation
+ */
+int q_descend_collect(struct list_head *head, struct list_head *list);
+
+/**
+ * q_merge_cmp() - Merge all the queues into one sorted queue with a given
+ * comparator
+ * @head: header of chain
+ * @cmp: comparator the queues are sorted by
+ * @descend: whether the queues are sorted in descending order
+ *
+ * Same contract as q_merge(), which is q_merge_cmp() with q_cmp_lex. The
+ * queues are merged at once with a min-heap over their heads, in O(N log k)
+ * time for N elements in k queues. Equal elements keep their queue order.
+ *
+ * Return: the number of elements in queue after merging
+ */
+int q_merge_cmp(struct list_head *head, q_cmp_t cmp, bool descend);
+
+/**
+ * q_merge_pairwise() - Merge all the queues into one sorted queue by merging
+ * adjacent pairs in rounds
+ * @head: header of chain
+ * @cmp: comparator the queues are sorted by
+ * @descend: whether the queues are sorted in descending order
+ *
+ * Same result as q_merge_cmp(), which merges all queues at once through a
+ * min-heap over their heads. Both take O(N log k) time for N elements in k
+ * queues; this variant is kept for comparison.
+ *
+ * Return: the number of elements in queue after merging
+ */
+int q_merge_pairwise(struct list_head *head, q_cmp_t cmp, bool descend);
+
+#endif /* LAB0_QUEUE_EXT_H */
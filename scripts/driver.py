@@ -35,7 +35,27 @@ class Tracer:
         14: "trace-14-perf",
         15: "trace-15-perf",
         16: "trace-16-perf",
-        17: "trace-17-complexity"
+        17: "trace-17-complexity",
+        18: "trace-18-size",
+        19: "trace-19-merge",
+        20: "trace-20-dedup",
+        21: "trace-21-reverseK",
+        22: "trace-22-bulk",
+        23: "trace-23-move",
+        24: "trace-24-lazy",
+        25: "trace-25-perf",
+        26: "trace-26-index",
+        27: "trace-27-compact",
+        28: "trace-28-cautious",
+        29: "trace-29-churn",
+        30: "trace-30-shuffle",
+        31: "trace-31-memprof",
+        32: "trace-32-lazyperf",
+        33: "trace-33-parsort",
+        34: "trace-34-radix",
+        35: "trace-35-order",
+        36: "trace-36-pairwise",
+        37: "trace-37-bulkfail"
     }
 
     traceProbs = {
@@ -55,10 +75,30 @@ class Tracer:
         14: "Trace-14",
         15: "Trace-15",
         16: "Trace-16",
-        17: "Trace-17"
+        17: "Trace-17",
+        18: "Trace-18",
+        19: "Trace-19",
+        20: "Trace-20",
+        21: "Trace-21",
+        22: "Trace-22",
+        23: "Trace-23",
+        24: "Trace-24",
+        25: "Trace-25",
+        26: "Trace-26",
+        27: "Trace-27",
+        28: "Trace-28",
+        29: "Trace-29",
+        30: "Trace-30",
+        31: "Trace-31",
+        32: "Trace-32",
+        33: "Trace-33",
+        34: "Trace-34",
+        35: "Trace-35",
+        36: "Trace-36",
+        37: "Trace-37"
     }
 
-    maxScores = [0, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5]
+    maxScores = [0, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6]
 
     RED = '\033[91m'
     GREEN = '\033[92m'
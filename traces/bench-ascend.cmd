@@ -0,0 +1,31 @@
+# Benchmark of 'ascend' and 'descend', with and without freeing the removed
+# elements, on 1M random strings, first in insertion order, then scattered in
+# memory by a shuffle
+# Run with: ./qtest -v 1 -f traces/bench-ascend.cmd
+option fail 0
+option malloc 0
+option timeout 0
+new
+ih RAND 1000000
+time ascend
+free
+new
+it RAND 1000000
+time descend
+free
+new
+ih RAND 1000000
+time ascend -c
+it RAND 1000000
+time descend -c
+free
+new
+ih RAND 1000000
+shuffle
+time ascend
+free
+new
+it RAND 1000000
+shuffle
+time descend
+free
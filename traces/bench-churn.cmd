@@ -0,0 +1,2012 @@
+# Benchmark of allocation churn: elements deleted and inserted at random
+# positions in bursts, over a queue that stays the same size. Freed blocks are
+# reused rather than left as holes in their slab chunks.
+# Run with: ./qtest -v 1 -f traces/bench-churn.cmd
+option fail 0
+option malloc 0
+option timeout 0
+option index 1
+new
+ih RAND 100000
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+delat RAND 400
+insat RAND churn 400
+cachestat
+free
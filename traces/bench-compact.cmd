@@ -0,0 +1,18 @@
+# Benchmark of traversals over 2M elements scattered in memory by a shuffle,
+# before and after 'compact' lays them out in queue order
+# Run with: ./qtest -v 1 -f traces/bench-compact.cmd
+option fail 0
+option malloc 0
+option timeout 0
+new
+it RAND 2000000
+shuffle
+time reverse
+time reverse
+time sort
+shuffle
+time compact
+time reverse
+time reverse
+time sort
+free
@@ -0,0 +1,226 @@
+# Benchmark of 'dedup -h' against 'sort' + 'dedup' on 1M strings, half of
+# them copies of 100 values, in random order, then on 1M distinct strings
+# Run with: ./qtest -v 1 -f traces/bench-dedup.cmd
+option fail 0
+option malloc 0
+option timeout 0
+new
+ih RAND 500000
+ih dup00 5000
+ih dup01 5000
+ih dup02 5000
+ih dup03 5000
+ih dup04 5000
+ih dup05 5000
+ih dup06 5000
+ih dup07 5000
+ih dup08 5000
+ih dup09 5000
+ih dup10 5000
+ih dup11 5000
+ih dup12 5000
+ih dup13 5000
+ih dup14 5000
+ih dup15 5000
+ih dup16 5000
+ih dup17 5000
+ih dup18 5000
+ih dup19 5000
+ih dup20 5000
+ih dup21 5000
+ih dup22 5000
+ih dup23 5000
+ih dup24 5000
+ih dup25 5000
+ih dup26 5000
+ih dup27 5000
+ih dup28 5000
+ih dup29 5000
+ih dup30 5000
+ih dup31 5000
+ih dup32 5000
+ih dup33 5000
+ih dup34 5000
+ih dup35 5000
+ih dup36 5000
+ih dup37 5000
+ih dup38 5000
+ih dup39 5000
+ih dup40 5000
+ih dup41 5000
+ih dup42 5000
+ih dup43 5000
+ih dup44 5000
+ih dup45 5000
+ih dup46 5000
+ih dup47 5000
+ih dup48 5000
+ih dup49 5000
+ih dup50 5000
+ih dup51 5000
+ih dup52 5000
+ih dup53 5000
+ih dup54 5000
+ih dup55 5000
+ih dup56 5000
+ih dup57 5000
+ih dup58 5000
+ih dup59 5000
+ih dup60 5000
+ih dup61 5000
+ih dup62 5000
+ih dup63 5000
+ih dup64 5000
+ih dup65 5000
+ih dup66 5000
+ih dup67 5000
+ih dup68 5000
+ih dup69 5000
+ih dup70 5000
+ih dup71 5000
+ih dup72 5000
+ih dup73 5000
+ih dup74 5000
+ih dup75 5000
+ih dup76 5000
+ih dup77 5000
+ih dup78 5000
+ih dup79 5000
+ih dup80 5000
+ih dup81 5000
+ih dup82 5000
+ih dup83 5000
+ih dup84 5000
+ih dup85 5000
+ih dup86 5000
+ih dup87 5000
+ih dup88 5000
+ih dup89 5000
+ih dup90 5000
+ih dup91 5000
+ih dup92 5000
+ih dup93 5000
+ih dup94 5000
+ih dup95 5000
+ih dup96 5000
+ih dup97 5000
+ih dup98 5000
+ih dup99 5000
+shuffle
+time dedup -h
+free
+new
+ih RAND 500000
+ih dup00 5000
+ih dup01 5000
+ih dup02 5000
+ih dup03 5000
+ih dup04 5000
+ih dup05 5000
+ih dup06 5000
+ih dup07 5000
+ih dup08 5000
+ih dup09 5000
+ih dup10 5000
+ih dup11 5000
+ih dup12 5000
+ih dup13 5000
+ih dup14 5000
+ih dup15 5000
+ih dup16 5000
+ih dup17 5000
+ih dup18 5000
+ih dup19 5000
+ih dup20 5000
+ih dup21 5000
+ih dup22 5000
+ih dup23 5000
+ih dup24 5000
+ih dup25 5000
+ih dup26 5000
+ih dup27 5000
+ih dup28 5000
+ih dup29 5000
+ih dup30 5000
+ih dup31 5000
+ih dup32 5000
+ih dup33 5000
+ih dup34 5000
+ih dup35 5000
+ih dup36 5000
+ih dup37 5000
+ih dup38 5000
+ih dup39 5000
+ih dup40 5000
+ih dup41 5000
+ih dup42 5000
+ih dup43 5000
+ih dup44 5000
+ih dup45 5000
+ih dup46 5000
+ih dup47 5000
+ih dup48 5000
+ih dup49 5000
+ih dup50 5000
+ih dup51 5000
+ih dup52 5000
+ih dup53 5000
+ih dup54 5000
+ih dup55 5000
+ih dup56 5000
+ih dup57 5000
+ih dup58 5000
+ih dup59 5000
+ih dup60 5000
+ih dup61 5000
+ih dup62 5000
+ih dup63 5000
+ih dup64 5000
+ih dup65 5000
+ih dup66 5000
+ih dup67 5000
+ih dup68 5000
+ih dup69 5000
+ih dup70 5000
+ih dup71 5000
+ih dup72 5000
+ih dup73 5000
+ih dup74 5000
+ih dup75 5000
+ih dup76 5000
+ih dup77 5000
+ih dup78 5000
+ih dup79 5000
+ih dup80 5000
+ih dup81 5000
+ih dup82 5000
+ih dup83 5000
+ih dup84 5000
+ih dup85 5000
+ih dup86 5000
+ih dup87 5000
+ih dup88 5000
+ih dup89 5000
+ih dup90 5000
+ih dup91 5000
+ih dup92 5000
+ih dup93 5000
+ih dup94 5000
+ih dup95 5000
+ih dup96 5000
+ih dup97 5000
+ih dup98 5000
+ih dup99 5000
+shuffle
+time sort
+time dedup
+free
+new
+ih RAND 1000000
+time dedup -h
+free
+new
+ih RAND 1000000
+time sort
+time dedup
+free
@@ -0,0 +1,28 @@
+# Benchmark of list traversals on 10M elements scattered in memory by a
+# shuffle, each prefetching ahead of the list: 'dedup -h' loads hash slots,
+# 'dedup' and 'free' load strings, and 'merge' loads the nodes that come next
+# Run with: ./qtest -v 1 -f traces/bench-prefetch.cmd
+# The prefetch distance is set at build time, for example:
+#   make clean && make qtest CFLAGS="-O1 -g -Wall -Idudect -I. \
+#       -DLIST_PREFETCH_DISTANCE=16"
+option fail 0
+option malloc 0
+option timeout 0
+new
+it RAND 8000000
+it dupa 1000000
+it dupb 1000000
+shuffle
+time dedup -h
+time free
+new
+it RAND 5000000
+shuffle
+sort
+time dedup
+new
+it RAND 5000000
+shuffle
+sort
+time merge
+time free
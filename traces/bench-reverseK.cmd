@@ -0,0 +1,13 @@
+# Benchmark of 'q_reverseK' applied per K against 'q_reverseK_many'
+# Run with: ./qtest -v 1 -f traces/bench-reverseK.cmd
+option fail 0
+option malloc 0
+option timeout 0
+new
+ih RAND 2000000
+time reverseK 3
+time reverseK 4
+time reverseK 5
+time reverseK 3 4 5
+time reverseK 2 8 16
+free
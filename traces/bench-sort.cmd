@@ -0,0 +1,19 @@
+# Benchmark of 'q_sort' against 'q_sort_radix' on trace-15-style input
+# Run with: ./qtest -v 1 -f traces/bench-sort.cmd
+option fail 0
+option malloc 0
+option timeout 0
+option sortalgo 0
+new
+ih RAND 1000000
+time sort
+reverse
+time sort
+free
+option sortalgo 1
+new
+ih RAND 1000000
+time sort
+reverse
+time sort
+free
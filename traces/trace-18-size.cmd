@@ -0,0 +1,6 @@
+# Test performance of 'q_size' on a large queue: 'q_new', 'q_insert_head', and 'q_size'
+option fail 0
+option malloc 0
+new
+ih dolphin 1000000
+size 1000
@@ -0,0 +1,3004 @@
+# Test performance of 'q_merge' on 1000 sorted queues of 1000 elements each
+option fail 0
+option malloc 0
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+new
+ih RAND 1000
+sort
+time merge
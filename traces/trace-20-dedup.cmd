@@ -0,0 +1,22 @@
+# Test of 'q_delete_dup_hash' on unsorted queues: 'q_new', 'q_insert_head', 'q_insert_tail', and 'q_free'
+new
+ih gerbil
+it lion
+ih zebra
+it gerbil
+ih dolphin
+it zebra
+it gerbil
+dedup -h
+it lion
+dedup -h
+free
+new
+ih RAND 5000
+it bear 3
+ih bear 2
+it yak 2
+shuffle
+dedup -h
+dedup -h
+free
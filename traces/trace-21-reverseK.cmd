@@ -0,0 +1,18 @@
+# Test of 'q_reverseK' and 'q_reverseK_many': 'q_new', 'q_insert_tail', 'q_insert_head', and 'q_free'
+new
+it a
+it b
+it c
+it d
+it e
+it f
+it g
+reverseK 3
+reverseK 2 3
+reverseK 4 2 7
+reverseK 8 1
+ih RAND 1000
+reverseK 5 7 9
+reverseK 16 17
+reverseK 1000 3
+free
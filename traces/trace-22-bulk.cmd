@@ -0,0 +1,19 @@
+# Test of 'q_insert_head_bulk', 'q_insert_tail_bulk', 'q_remove_head_bulk', and 'q_remove_tail_bulk': 'q_new', 'q_remove_head', 'q_remove_tail', and 'q_free'
+option bulk 1
+new
+ih dolphin 3
+it gerbil 300
+ih bear 2
+rh bear 2
+rh dolphin
+rt gerbil 299
+rh dolphin 2
+rh gerbil 1
+size
+it lion 1000
+ih zebra 257
+rt lion 999
+rt lion
+rh zebra 257
+ih RAND 600
+free
@@ -0,0 +1,25 @@
+# Test of 'q_insert_tail_adopt' and 'q_unwrap_element': 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', and 'q_free'
+new
+ih gerbil
+it lion
+it zebra
+new
+it dolphin
+prev
+move
+move 2
+next
+rh dolphin
+rh gerbil
+move
+ih RAND 100
+move 100
+next
+move 101
+prev
+option fail 100
+option malloc 50
+move 40
+option malloc 0
+free
+free
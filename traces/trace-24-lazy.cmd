@@ -0,0 +1,43 @@
+# Test of 'q_reverse_lazy' with operations honoring it: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', 'q_remove_tail', 'q_delete_mid', 'q_delete_dup', 'q_swap', 'q_sort', 'q_merge', and 'q_free'
+option lazyreverse 1
+new
+it a
+it b
+it c
+it d
+it e
+reverse
+ih z
+it y
+rh z
+rt y
+rh e
+reverse
+rh a
+it x 3
+reverse
+rh x 2
+rt b 1
+dm
+swap
+reverse
+new
+it m
+it n
+reverse
+sort
+prev
+reverse
+merge
+reverse
+it n 2
+reverse
+dedup
+reverse
+reverseK 2
+reverse
+dedup -h
+reverse
+descend
+rh x
+free
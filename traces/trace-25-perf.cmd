@@ -0,0 +1,17 @@
+# Test performance of 'q_ascend' and 'q_descend' on random strings: 'q_new', 'q_insert_head', 'q_insert_tail', and 'q_free'
+option fail 0
+option malloc 0
+new
+ih RAND 200000
+ascend
+free
+new
+it RAND 200000
+descend
+free
+new
+ih RAND 200000
+ascend -c
+it RAND 200000
+descend -c
+free
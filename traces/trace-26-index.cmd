@@ -0,0 +1,24 @@
+# Test performance of 'q_get', 'q_insert_at' and 'q_delete_at' on a large queue with a skip-list index
+option fail 0
+option malloc 0
+option index 1
+new
+it a
+it c
+insat 1 b
+insat 3 d
+get 2
+delat 0
+ih a
+it RAND 200000
+get RAND 100000
+insat RAND RAND 100000
+delat RAND 100000
+dm
+sort
+get RAND 100000
+option lazyreverse 1
+reverse
+insat RAND RAND 100000
+delat RAND 100000
+free
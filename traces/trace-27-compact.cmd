@@ -0,0 +1,35 @@
+# Test of 'q_compact' with 'q_reverse_lazy', the positional index and failing allocations
+option fail 10
+new
+it a
+it b
+ih c
+compact
+rh c
+ih c
+option lazyreverse 1
+reverse
+compact
+rh b
+rt c
+ih b
+it c
+option index 1
+insat 1 x
+get 1
+compact
+get 1
+delat 1
+rh b
+rh a
+rh c
+it RAND 1000
+shuffle
+compact
+option malloc 30
+compact
+compact
+option malloc 0
+sort
+compact
+free
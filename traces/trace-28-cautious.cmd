@@ -0,0 +1,15 @@
+# Test of freeing 1M elements with every free checked in cautious mode: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', 'q_delete_mid', and 'q_free'
+option fail 0
+option malloc 0
+new
+ih RAND 500000
+it RAND 500000
+rh
+dm
+free
+new
+ih RAND 500000
+new
+it RAND 500000
+free
+free
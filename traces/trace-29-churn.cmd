@@ -0,0 +1,28 @@
+# Test of inserting and removing elements repeatedly, with freed blocks reused: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', 'q_remove_tail', 'q_delete_mid', and 'q_free', with the block cache counts shown by 'cachestat'
+option fail 0
+option malloc 0
+cachestat -r
+new
+ih RAND 10000
+it churn 1000
+rt churn 1000
+ih churn 1000
+rh churn 1000
+it churn 1000
+rt churn 1000
+cachestat -r
+option index 1
+delat RAND 2000
+insat RAND churn 2000
+dm
+ih gerbil
+rh gerbil
+it dolphin
+rt dolphin
+cachestat
+free
+new
+ih RAND 10000
+reverse
+sort
+free
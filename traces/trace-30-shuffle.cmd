@@ -0,0 +1,17 @@
+# Test of 'shuffle', which allocates an array of the queue's elements, with failing allocations: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_size', 'q_sort', and 'q_free'
+option fail 10
+option malloc 0
+new
+ih RAND 5
+shuffle
+it RAND 100000
+shuffle
+size
+option malloc 20
+shuffle
+shuffle
+shuffle
+option malloc 0
+sort
+size
+free
@@ -0,0 +1,22 @@
+# Test of allocation profiling by call site with 'memstat', with failing allocations: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', 'q_size', 'q_sort', and 'q_free'
+option fail 10
+option memprof 1
+new
+ih RAND 1000
+it RAND 1000
+rh
+rh
+memstat
+option malloc 20
+shuffle
+shuffle
+shuffle
+option malloc 0
+sort
+size
+memstat -r
+ih RAND 100
+option memprof 0
+ih RAND 100
+memstat
+free
@@ -0,0 +1,15 @@
+# Test performance of 'q_reverse_lazy' with operations honoring it: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', 'q_remove_tail', 'q_sort', and 'q_free'
+option fail 0
+option malloc 0
+option lazyreverse 1
+new
+ih dolphin 1000000
+it gerbil 1000
+reverse
+it jaguar 1000
+rh gerbil
+rt jaguar
+reverse
+ih dolphin 1000000
+reverse
+sort
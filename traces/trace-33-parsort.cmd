@@ -0,0 +1,31 @@
+# Test of 'q_sort_parallel' on queues above and below the size for sorting on several threads: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', 'q_sort', and 'q_free'
+option fail 0
+option malloc 0
+option sortthreads 4
+option sortparsize 1000
+new
+ih RAND 50000
+it dolphin 1000
+ih gerbil 1000
+it RAND 20000
+sort
+option descend 1
+sort
+option descend 0
+option order 3
+sort
+option order 0
+option sortthreads 3
+ih RAND 10000
+it gerbil 500
+sort
+option sortalgo 1
+sort
+option sortalgo 0
+free
+new
+ih RAND 500
+it dolphin 10
+sort
+rh
+free
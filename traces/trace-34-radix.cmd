@@ -0,0 +1,33 @@
+# Test of 'q_sort_radix' on duplicate keys and long shared prefixes: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_sort', and 'q_free'
+option fail 0
+option malloc 0
+option sortalgo 1
+new
+ih RAND 30000
+it internationalization 300
+ih internationalize 300
+it internationalizations 300
+ih international 300
+it internationalizationb 300
+ih internationalization 300
+it intern 300
+ih i 300
+it RAND 30000
+ih RAND 30000
+sort
+option descend 1
+sort
+ih internationalizationa 200
+it internationalization 200
+sort
+option descend 0
+sort
+free
+new
+ih zzzzzzzzzzzzzzzzzzzz1 50
+it zzzzzzzzzzzzzzzzzzzz 50
+ih zzzzzzzzzzzzzzzzzzzz0 50
+sort
+option descend 1
+sort
+free
@@ -0,0 +1,179 @@
+# Test of sorting and merging in every order of 'option order', with 'ascend' and 'descend': 'q_new', 'q_insert_head', 'q_insert_tail', 'q_sort', 'q_merge', 'q_ascend', 'q_descend', and 'q_free'
+option fail 0
+option malloc 0
+option order 0
+option descend 0
+new
+ih RAND 200
+it gerbil 5
+ih dolphin 5
+sort
+new
+ih RAND 150
+it gerbil 3
+sort
+new
+ih RAND 100
+sort
+merge
+ascend
+free
+option descend 1
+new
+ih RAND 200
+it gerbil 5
+ih dolphin 5
+sort
+new
+ih RAND 150
+it gerbil 3
+sort
+new
+ih RAND 100
+sort
+merge
+descend
+free
+option order 1
+option descend 0
+new
+ih 10 3
+it 9 3
+ih 100
+it -5 2
+ih 7x
+it 7a
+ih RAND 50
+sort
+new
+ih 042
+it 42
+ih 8 4
+it RAND 20
+sort
+new
+ih -12
+it 1000000
+ih 3 5
+sort
+merge
+ascend
+free
+option descend 1
+new
+ih 10 3
+it 9 3
+ih 100
+it -5 2
+ih 7x
+it 7a
+ih RAND 50
+sort
+new
+ih 042
+it 42
+ih 8 4
+it RAND 20
+sort
+new
+ih -12
+it 1000000
+ih 3 5
+sort
+merge
+descend
+free
+option order 2
+option descend 0
+new
+ih Apple
+it apple 2
+ih APPLE
+it banana
+ih Banana 3
+it RAND 50
+sort
+new
+ih aPPle
+it CHERRY 2
+ih cherry
+it RAND 40
+sort
+new
+ih Zebra
+it zebra
+ih ZEBRA 2
+sort
+merge
+ascend
+free
+option descend 1
+new
+ih Apple
+it apple 2
+ih APPLE
+it banana
+ih Banana 3
+it RAND 50
+sort
+new
+ih aPPle
+it CHERRY 2
+ih cherry
+it RAND 40
+sort
+new
+ih Zebra
+it zebra
+ih ZEBRA 2
+sort
+merge
+descend
+free
+option order 3
+option descend 0
+new
+ih a 3
+it bb
+ih ab 2
+it ccc
+ih RAND 60
+sort
+new
+ih zz 2
+it yyy
+ih x
+it RAND 40
+sort
+new
+ih dddd
+it aaaa
+ih RAND 30
+sort
+merge
+ascend
+free
+option descend 1
+new
+ih a 3
+it bb
+ih ab 2
+it ccc
+ih RAND 60
+sort
+new
+ih zz 2
+it yyy
+ih x
+it RAND 40
+sort
+new
+ih dddd
+it aaaa
+ih RAND 30
+sort
+merge
+descend
+free
+option order 0
+option descend 0
@@ -0,0 +1,3338 @@
+# Test of 'q_merge_pairwise' on a chain of more queues than are merged at once, and on duplicates in descending order: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_sort', 'q_merge', and 'q_free'
+option fail 0
+option malloc 0
+option mergealgo 1
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+new
+ih RAND 20
+sort
+merge
+size
+free
+option descend 1
+new
+ih gerbil 1
+it RAND 30
+ih dolphin 3
+sort
+new
+ih gerbil 2
+it RAND 30
+ih dolphin 3
+sort
+new
+ih gerbil 3
+it RAND 30
+ih dolphin 3
+sort
+new
+ih gerbil 4
+it RAND 30
+ih dolphin 3
+sort
+new
+ih gerbil 5
+it RAND 30
+ih dolphin 3
+sort
+new
+merge
+free
+option descend 0
+option mergealgo 0
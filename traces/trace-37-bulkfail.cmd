@@ -0,0 +1,27 @@
+# Test of 'q_insert_head_bulk' and 'q_insert_tail_bulk' with failing allocations and a pending lazy reversal: 'q_new', 'q_insert_head', 'q_insert_tail', 'q_remove_head', 'q_remove_tail', 'q_reverse', and 'q_free'
+option fail 100
+option malloc 0
+option bulk 1
+new
+ih RAND 1000
+option malloc 10
+it tiger 60
+ih RAND 30
+it RAND 300
+option malloc 0
+option lazyreverse 1
+reverse
+ih lion 300
+it zebra 300
+rh lion 300
+rt zebra 300
+reverse
+option lazyreverse 0
+it gerbil 1
+ih dolphin 1
+rt gerbil
+rh dolphin
+option bulk 0
+ih bear 2
+rh bear 2
+free